@@ -0,0 +1,855 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory_resource>
+#include <new>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Grants the benchmarks access to the nickname generator internals.
+#define DASMIG_NNG_BENCHMARK
+#include "../dasmig/nicknamegen.hpp"
+
+// Amount of allocations made by the whole program.
+std::atomic<std::size_t> allocations{0};
+
+// Amount of bytes requested by every allocation of the whole program.
+std::atomic<std::size_t> allocated_bytes{0};
+
+// Counts every allocation before forwarding it to malloc.
+void* operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (void* memory{std::malloc(std::max<std::size_t>(size, 1))})
+    {
+        return memory;
+    }
+
+    throw(std::bad_alloc());
+}
+
+// Counts every over aligned allocation before forwarding it to aligned_alloc.
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+    // Aligned allocations must request a multiple of the alignment.
+    const auto align{static_cast<std::size_t>(alignment)};
+
+    if (void* memory{std::aligned_alloc(
+            align, std::max(align, (size + align - 1) / align * align))})
+    {
+        return memory;
+    }
+
+    throw(std::bad_alloc());
+}
+
+// Releases memory allocated by the counting operator new, kept out of line so
+// the compiler doesn't warn about freeing memory returned by operator new.
+[[gnu::noinline]] void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+// Releases memory allocated by the counting operator new.
+[[gnu::noinline]] void operator delete(void* memory,
+                                       std::size_t /*size*/) noexcept
+{
+    std::free(memory);
+}
+
+// Releases memory allocated by the counting aligned operator new.
+[[gnu::noinline]] void operator delete(
+    void* memory, std::align_val_t /*alignment*/) noexcept
+{
+    std::free(memory);
+}
+
+// Releases memory allocated by the counting aligned operator new.
+[[gnu::noinline]] void operator delete(
+    void* memory, std::size_t /*size*/,
+    std::align_val_t /*alignment*/) noexcept
+{
+    std::free(memory);
+}
+
+// Exposes the nickname generator internals measured by the benchmarks.
+namespace dasmig
+{
+struct benchmark_access
+{
+    // Whether the character is a vowel.
+    static bool is_vowel(wchar_t character)
+    {
+        return nng::is_vowel(character);
+    }
+
+    // Leetified replacement of the character, null if it has none.
+    static wchar_t leet(wchar_t character)
+    {
+        return nng::leet(character);
+    }
+
+    // Converts each character case, one character at a time.
+    static void convert_case_scalar(std::wstring& text, std::uint64_t pattern)
+    {
+        nng::convert_case_scalar(text.data(), text.size(), pattern);
+    }
+
+    // Converts each character case with the widest supported instructions.
+    static void convert_case(std::wstring& text, std::uint64_t pattern)
+    {
+        nng::convert_case(text.data(), text.size(), pattern);
+    }
+
+    // Leetifies every character, one character at a time.
+    static void leet_scalar(std::wstring& text)
+    {
+        nng::leet_scalar(text.data(), text.size());
+    }
+
+    // Leetifies every character with the widest supported instructions.
+    static void leet_all(std::wstring& text)
+    {
+        nng::leet_all(text.data(), text.size());
+    }
+
+    // Amount of words parsed from the wordlists file.
+    static std::size_t parse_file(const std::filesystem::path& file)
+    {
+        return nng::parse_file(file).size();
+    }
+
+    // Name read by the strategies, either reading the cached results of the
+    // prepared name or computing them on the fly.
+    static auto view(const prepared_name& name, bool cached)
+    {
+        // View of the prepared name and its cached results.
+        auto viewed{nng::view(name)};
+
+        if (!cached)
+        {
+            viewed.cached = nullptr;
+        }
+
+        return viewed;
+    }
+
+    // Strategies turning a name into the nickname.
+    static constexpr auto first_name{&nng::first_name};
+    static constexpr auto last_name{&nng::last_name};
+    static constexpr auto any_name{&nng::any_name};
+    static constexpr auto initials{&nng::initials};
+    static constexpr auto mix_two{&nng::mix_two};
+    static constexpr auto first_plus_initial{&nng::first_plus_initial};
+    static constexpr auto initial_plus_last{&nng::initial_plus_last};
+    static constexpr auto reduce_single_name{&nng::reduce_single_name};
+
+    // Transforms applied to the nickname while leetifying it.
+    static constexpr auto reverse{&nng::reverse};
+    static constexpr auto xfy{&nng::xfy};
+    static constexpr auto yfy{&nng::yfy};
+    static constexpr auto tracefy{&nng::tracefy};
+    static constexpr auto ingify{&nng::ingify};
+    static constexpr auto numify{&nng::numify};
+    static constexpr auto duovowel{&nng::duovowel};
+    static constexpr auto oneleet{&nng::oneleet};
+    static constexpr auto allleet{&nng::allleet};
+    static constexpr auto leetify{&nng::leetify};
+
+    // Cases the nickname is formatted with.
+    static constexpr auto snake_case{&nng::snake_case};
+    static constexpr auto upper_case{&nng::upper_case};
+    static constexpr auto lower_case{&nng::lower_case};
+    static constexpr auto title_case{&nng::title_case};
+    static constexpr auto sentence_case{&nng::sentence_case};
+    static constexpr auto camel_case{&nng::camel_case};
+    static constexpr auto reverse_sentence_case{&nng::reverse_sentence_case};
+    static constexpr auto bathtub_case{&nng::bathtub_case};
+    static constexpr auto winding_case{&nng::winding_case};
+    static constexpr auto random_case{&nng::random_case};
+    static constexpr auto random_single_case{&nng::random_single_case};
+    static constexpr auto format{&nng::format};
+};
+} // namespace dasmig
+
+// Sink for benchmarked results.
+const void* volatile benchmark_sink{nullptr};
+
+// Prevents the compiler from optimizing away a benchmarked result.
+template <typename T> void do_not_optimize(const T& value)
+{
+    benchmark_sink = &value;
+}
+
+// Runs the received function the requested number of times and reports the
+// average cost of a single operation, each call performing batch_size of them:
+// its time, the allocations it makes and the bytes they request.
+template <typename Function>
+void measure(const char* label, std::size_t iterations, Function&& function,
+             std::size_t batch_size = 1)
+{
+    const std::size_t allocations_before{allocations.load()};
+    const std::size_t bytes_before{allocated_bytes.load()};
+    const auto start{std::chrono::steady_clock::now()};
+
+    for (std::size_t i{0}; i < iterations; i++)
+    {
+        function();
+    }
+
+    const auto elapsed{std::chrono::steady_clock::now() - start};
+
+    // Amount of operations performed.
+    const auto operations{static_cast<double>(iterations * batch_size)};
+
+    std::printf(
+        "%-48s %12.1f ns/op %8.2f allocs/op %10.1f bytes/op\n", label,
+        std::chrono::duration<double, std::nano>(elapsed).count() / operations,
+        static_cast<double>(allocations.load() - allocations_before) /
+            operations,
+        static_cast<double>(allocated_bytes.load() - bytes_before) /
+            operations);
+}
+
+// Writes a synthetic wordlist with the requested number of words.
+void write_wordlist(const std::filesystem::path& file, std::size_t words)
+{
+    std::ofstream output{file};
+
+    for (std::size_t i{0}; i < words; i++)
+    {
+        output << "word" << i << '\n';
+    }
+}
+
+// Word based generation cost must not depend on the size of the wordlists,
+// each step loads a bigger list into the generator and measures again.
+void bench_wordlist_size(const std::filesystem::path& workspace)
+{
+    for (std::size_t words : {100, 10'000, 1'000'000})
+    {
+        const std::filesystem::path folder{workspace /
+                                           std::to_string(words)};
+
+        std::filesystem::create_directories(folder);
+        write_wordlist(folder / "synthetic.words", words);
+        dasmig::nng::instance().load(folder);
+
+        const std::string label{"get_nickname() +" + std::to_string(words) +
+                                " words list"};
+
+        measure(label.c_str(), 100'000, [] {
+            do_not_optimize(dasmig::nng::instance().get_nickname());
+        });
+    }
+}
+
+// Weighted word draws must cost the same regardless of the amount of words,
+// each step loads a bigger weighted list into its own generator.
+void bench_weighted(const std::filesystem::path& workspace)
+{
+    for (std::size_t words : {100, 10'000, 1'000'000})
+    {
+        const std::filesystem::path folder{
+            workspace / ("weighted" + std::to_string(words))};
+
+        std::filesystem::create_directories(folder);
+
+        {
+            std::ofstream output{folder / "synthetic.words"};
+
+            for (std::size_t i{0}; i < words; i++)
+            {
+                output << "word" << i << '\t' << (i % 100) + 1 << '\n';
+            }
+        }
+
+        const dasmig::nng generator{folder};
+
+        const std::string label{"get_nickname() " + std::to_string(words) +
+                                " weighted words"};
+
+        measure(label.c_str(), 100'000, [&generator] {
+            do_not_optimize(generator.get_nickname());
+        });
+    }
+}
+
+// Loading a compiled wordlists file must not depend on the corpus size, unlike
+// parsing the wordlists files it was compiled from.
+void bench_compiled_load(const std::filesystem::path& workspace)
+{
+    const std::filesystem::path folder{workspace / "compiled"};
+    const std::filesystem::path compiled_file{workspace / "compiled.cwords"};
+
+    std::filesystem::create_directories(folder);
+    write_wordlist(folder / "synthetic.words", 1'000'000);
+    dasmig::nng::compile(folder, compiled_file);
+
+    measure("load() 1000000 words .words", 1,
+            [&folder] { dasmig::nng::instance().load(folder); });
+
+    measure("load() 1000000 words .cwords", 1,
+            [&compiled_file] { dasmig::nng::instance().load(compiled_file); });
+}
+
+// Parsing wordlists files costs about the same for ASCII and other UTF-8
+// content, neither depending on the locale.
+void bench_utf8_load(const std::filesystem::path& workspace)
+{
+    const std::filesystem::path folder{workspace / "utf8"};
+
+    std::filesystem::create_directories(folder);
+
+    {
+        std::ofstream output{folder / "synthetic.words", std::ios::binary};
+
+        for (std::size_t i{0}; i < 1'000'000; i++)
+        {
+            output << "\xE3\x81\x93\xE3\x81\xA8\xE3\x81\xB0" << i
+                   << "\r\n";
+        }
+    }
+
+    measure("load() 1000000 words non-ASCII .words", 1,
+            [&folder] { dasmig::nng::instance().reload(folder); });
+}
+
+// Loading a folder with many wordlists files parses them concurrently, the
+// slowest file bounds the time of each thread.
+void bench_parallel_load(const std::filesystem::path& workspace)
+{
+    const std::filesystem::path folder{workspace / "parallel"};
+
+    std::filesystem::create_directories(folder);
+
+    for (std::size_t i{0}; i < 64; i++)
+    {
+        write_wordlist(folder / ("synthetic" + std::to_string(i) + ".words"),
+                       20'000);
+    }
+
+    std::vector<dasmig::file_load> report;
+
+    measure("load() 64 files x 20000 words .words", 1, [&folder, &report] {
+        report = dasmig::nng::instance().reload(folder);
+    });
+
+    // Slowest file of the load.
+    dasmig::file_load slowest;
+
+    for (const auto& loaded : report)
+    {
+        if (loaded.duration > slowest.duration)
+        {
+            slowest = loaded;
+        }
+    }
+
+    std::printf("%-48s %12.1f ns\n", "load() slowest file",
+                std::chrono::duration<double, std::nano>(slowest.duration)
+                    .count());
+}
+
+// Generating nicknames from a prepared name or in batches reuses the name
+// splitting, batches also reuse the memory of the previous batch.
+void bench_batch()
+{
+    measure("get_nickname(name)", 100'000, [] {
+        do_not_optimize(
+            dasmig::nng::instance().get_nickname(L"Alberto Bins Elis"));
+    });
+
+    const dasmig::prepared_name prepared{L"Alberto Bins Elis"};
+
+    measure("get_nickname(prepared_name)", 100'000, [&prepared] {
+        do_not_optimize(dasmig::nng::instance().get_nickname(prepared));
+    });
+
+    // Stack memory backing the arena of each generated nickname.
+    std::array<std::byte, 4096> buffer{};
+
+    std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size()};
+
+    measure("get_nickname(name, arena)", 100'000, [&arena] {
+        do_not_optimize(dasmig::nng::instance().get_nickname(
+            L"Alberto Bins Elis", &arena));
+        arena.release();
+    });
+
+    std::vector<dasmig::nickname> nicknames;
+
+    measure(
+        "get_nicknames(1000, name)", 100,
+        [&nicknames] {
+            dasmig::nng::instance().get_nicknames(nicknames, 1000,
+                                                  L"Alberto Bins Elis");
+            do_not_optimize(nicknames);
+        },
+        1000);
+}
+
+// Per character cost of the character traits lookups, compared against the
+// linear vowel search and leet map lookups they replaced.
+void bench_character_traits()
+{
+    using access = dasmig::benchmark_access;
+
+    // Mixed ASCII and Latin-1 characters to classify.
+    std::wstring text;
+
+    while (text.size() < 1'000'000)
+    {
+        text.append(L"Kind Github User Ålesund Çà ça Šárka 1337 ");
+    }
+
+    const std::wstring vowels{
+        L"aeiouáàâãäåæçèéêëìíîïðñòóôõöøšùúûüýÿ"};
+
+    const std::map<wchar_t, wchar_t> leet_map{
+        {L'o', L'0'}, {L'O', L'0'}, {L'i', L'1'}, {L'I', L'1'}, {L's', L'2'},
+        {L'S', L'2'}, {L'e', L'3'}, {L'E', L'3'}, {L'a', L'4'}, {L'A', L'4'},
+        {L'g', L'6'}, {L'G', L'6'}, {L't', L'7'}, {L'T', L'7'}, {L'b', L'8'},
+        {L'B', L'8'}, {L'q', L'9'}, {L'Q', L'9'}};
+
+    std::size_t matches{0};
+
+    measure(
+        "vowel linear search per character", 10,
+        [&] {
+            for (const auto& character : text)
+            {
+                matches += static_cast<std::size_t>(
+                    vowels.find(character) != std::wstring::npos);
+            }
+        },
+        text.size());
+
+    measure(
+        "is_vowel per character", 10,
+        [&] {
+            for (const auto& character : text)
+            {
+                matches +=
+                    static_cast<std::size_t>(access::is_vowel(character));
+            }
+        },
+        text.size());
+
+    measure(
+        "leet map lookup per character", 10,
+        [&] {
+            for (const auto& character : text)
+            {
+                if (leet_map.contains(character))
+                {
+                    matches += leet_map.at(character);
+                }
+            }
+        },
+        text.size());
+
+    measure(
+        "leet per character", 10,
+        [&] {
+            for (const auto& character : text)
+            {
+                matches += access::leet(character);
+            }
+        },
+        text.size());
+
+    do_not_optimize(matches);
+}
+
+// Per character cost of the case and leet kernels against their one character
+// at a time versions, for nickname sized and bulk buffers.
+void bench_kernels()
+{
+    using access = dasmig::benchmark_access;
+
+    for (std::size_t size : {12, 1'000'000})
+    {
+        // ASCII text with the occasional Latin-1 letter.
+        std::wstring text;
+
+        while (text.size() < size)
+        {
+            text.append(L"KindGithubUserÅlesund");
+        }
+
+        text.resize(size);
+
+        // Iterations keeping every measure around the same duration.
+        const std::size_t iterations{10'000'000 / size};
+
+        const std::string suffix{" " + std::to_string(size) + " chars"};
+
+        measure(
+            ("upper_case scalar" + suffix).c_str(), iterations,
+            [&text] { access::convert_case_scalar(text, ~std::uint64_t{0}); },
+            size);
+
+        measure(
+            ("upper_case kernel" + suffix).c_str(), iterations,
+            [&text] { access::convert_case(text, ~std::uint64_t{0}); }, size);
+
+        measure(
+            ("winding_case scalar" + suffix).c_str(), iterations,
+            [&text] { access::convert_case_scalar(text, 0x5555555555555555); },
+            size);
+
+        measure(
+            ("winding_case kernel" + suffix).c_str(), iterations,
+            [&text] { access::convert_case(text, 0x5555555555555555); }, size);
+
+        // Leetifying is destructive, each iteration works on a fresh copy.
+        const std::wstring original{text};
+
+        measure(
+            ("allleet scalar" + suffix).c_str(), iterations,
+            [&] {
+                text.assign(original);
+                access::leet_scalar(text);
+            },
+            size);
+
+        measure(
+            ("allleet kernel" + suffix).c_str(), iterations,
+            [&] {
+                text.assign(original);
+                access::leet_all(text);
+            },
+            size);
+
+        do_not_optimize(text);
+    }
+}
+
+// Generation cost of a nickname generator drawing from the requested engine,
+// each engine with its own generator loading the same wordlists.
+template <typename Engine>
+void bench_engine(const char* engine, const std::filesystem::path& folder)
+{
+    const dasmig::basic_nng<Engine> generator{folder, 1};
+
+    const std::string label{std::string{"get_nickname() "} + engine};
+
+    measure(label.c_str(), 100'000,
+            [&generator] { do_not_optimize(generator.get_nickname()); });
+
+    const std::string name_label{std::string{"get_nickname(name) "} + engine};
+
+    measure(name_label.c_str(), 100'000, [&generator] {
+        do_not_optimize(generator.get_nickname(L"Alberto Bins Elis"));
+    });
+}
+
+// Nickname generation cost with each random number engine, most of the work
+// per nickname is drawing random numbers.
+void bench_engines(const std::filesystem::path& workspace)
+{
+    const std::filesystem::path folder{workspace / "engines"};
+
+    std::filesystem::create_directories(folder);
+    write_wordlist(folder / "synthetic.words", 10'000);
+
+    bench_engine<dasmig::xoshiro256pp>("xoshiro256pp", folder);
+    bench_engine<std::mt19937>("mt19937", folder);
+    bench_engine<std::mt19937_64>("mt19937_64", folder);
+    bench_engine<std::minstd_rand>("minstd_rand", folder);
+}
+
+// Generation cost of the uniqueness mode and its retry rate, which grows as
+// the issued nicknames fill the space of generated ones.
+void bench_unique(const std::filesystem::path& workspace)
+{
+    const std::filesystem::path folder{workspace / "unique"};
+
+    std::filesystem::create_directories(folder);
+    write_wordlist(folder / "synthetic.words", 10'000);
+
+    dasmig::nng generator{folder, 1};
+
+    measure("get_nickname(name) repeated", 100'000, [&generator] {
+        do_not_optimize(generator.get_nickname(L"Alberto Bins Elis"));
+    });
+
+    generator.unique(true);
+
+    measure("get_nickname(name) unique", 100'000, [&generator] {
+        do_not_optimize(generator.get_nickname(L"Alberto Bins Elis"));
+    });
+
+    const dasmig::uniqueness_stats stats{generator.unique_stats()};
+
+    std::printf("%-48s %12llu issued %12llu retries\n", "unique stats",
+                static_cast<unsigned long long>(stats.issued),
+                static_cast<unsigned long long>(stats.retries));
+}
+
+// Cost of reserving a million taken nicknames, the memory they take, and the
+// generation cost once nicknames are checked against them.
+void bench_reserved(const std::filesystem::path& workspace)
+{
+    const std::filesystem::path folder{workspace / "reserved"};
+
+    std::filesystem::create_directories(folder);
+    write_wordlist(folder / "synthetic.words", 10'000);
+    write_wordlist(workspace / "taken.txt", 1'000'000);
+
+    dasmig::nng generator{folder, 1};
+
+    const dasmig::reserved_load loaded{
+        generator.reserve(workspace / "taken.txt")};
+
+    std::printf("%-48s %12.1f ms %8.2f bytes/nickname\n",
+                "reserve(1000000 nicknames)",
+                std::chrono::duration<double, std::milli>(loaded.duration)
+                    .count(),
+                static_cast<double>(loaded.bytes) /
+                    static_cast<double>(loaded.nicknames));
+
+    std::printf("%-48s %12.2f MB peak\n", "reserve(1000000 nicknames)",
+                static_cast<double>(loaded.peak_bytes) / (1024.0 * 1024.0));
+
+    measure("get_nickname(name) reserved", 100'000, [&generator] {
+        do_not_optimize(generator.get_nickname(L"Alberto Bins Elis"));
+    });
+}
+
+// Parsing and loading cost of synthetic corpora of growing size, per word.
+void bench_corpora(const std::filesystem::path& workspace, bool large)
+{
+    // Corpora sizes, the largest one only when requested.
+    std::vector<std::size_t> sizes{1'000, 10'000, 100'000, 1'000'000};
+
+    if (large)
+    {
+        sizes.push_back(10'000'000);
+    }
+
+    for (const auto& words : sizes)
+    {
+        const std::filesystem::path folder{workspace /
+                                           ("corpus" + std::to_string(words))};
+
+        std::filesystem::create_directories(folder);
+        write_wordlist(folder / "synthetic.words", words);
+
+        // Iterations keeping every measure around the same duration.
+        const std::size_t iterations{std::max<std::size_t>(
+            1, 1'000'000 / words)};
+
+        const std::string suffix{" " + std::to_string(words) + " words"};
+
+        measure(
+            ("parse_file() per word" + suffix).c_str(), iterations,
+            [&folder] {
+                do_not_optimize(dasmig::benchmark_access::parse_file(
+                    folder / "synthetic.words"));
+            },
+            words);
+
+        measure(
+            ("reload() per word" + suffix).c_str(), iterations,
+            [&folder] { do_not_optimize(dasmig::nng{}.reload(folder)); },
+            words);
+    }
+}
+
+// Cost of each strategy turning a name into the nickname, and of each
+// transform applied to the nickname afterwards.
+void bench_stages()
+{
+    using access = dasmig::benchmark_access;
+
+    const auto& generator{dasmig::nng::instance()};
+
+    const dasmig::prepared_name prepared{L"Alberto Bins Elis"};
+
+    // Nickname reused by every stage, keeping its memory.
+    std::wstring nickname;
+
+    for (const bool cached : {true, false})
+    {
+        // Name read by the strategies.
+        const auto name{access::view(prepared, cached)};
+
+        // Suffix telling cached results from results computed on the fly.
+        const std::string suffix{cached ? " cached" : " on the fly"};
+
+        // Measures a name strategy.
+        const auto strategy{[&](const std::string& label, auto stage) {
+            measure((label + suffix).c_str(), 1'000'000, [&] {
+                if constexpr (std::is_member_function_pointer_v<
+                                  decltype(stage)>)
+                {
+                    (generator.*stage)(name, nickname);
+                }
+                else
+                {
+                    stage(name, nickname);
+                }
+                do_not_optimize(nickname);
+            });
+        }};
+
+        strategy("first_name", access::first_name);
+        strategy("last_name", access::last_name);
+        strategy("any_name", access::any_name);
+        strategy("initials", access::initials);
+        strategy("mix_two", access::mix_two);
+        strategy("first_plus_initial", access::first_plus_initial);
+        strategy("initial_plus_last", access::initial_plus_last);
+        strategy("reduce_single_name", access::reduce_single_name);
+    }
+
+    // Word every transform starts from.
+    const std::wstring original{L"Nickname"};
+
+    // Measures a transform, each iteration starting from the original word.
+    const auto transform{[&](const char* label, auto stage) {
+        measure(label, 1'000'000, [&] {
+            nickname.assign(original);
+            if constexpr (std::is_member_function_pointer_v<decltype(stage)>)
+            {
+                (generator.*stage)(nickname);
+            }
+            else
+            {
+                stage(nickname);
+            }
+            do_not_optimize(nickname);
+        });
+    }};
+
+    transform("reverse", access::reverse);
+    transform("xfy", access::xfy);
+    transform("yfy", access::yfy);
+    transform("tracefy", access::tracefy);
+    transform("ingify", access::ingify);
+    transform("numify", access::numify);
+    transform("duovowel", access::duovowel);
+    transform("oneleet", access::oneleet);
+    transform("allleet", access::allleet);
+    transform("snake_case", access::snake_case);
+    transform("upper_case", access::upper_case);
+    transform("lower_case", access::lower_case);
+    transform("title_case", access::title_case);
+    transform("sentence_case", access::sentence_case);
+    transform("camel_case", access::camel_case);
+    transform("reverse_sentence_case", access::reverse_sentence_case);
+    transform("bathtub_case", access::bathtub_case);
+    transform("winding_case", access::winding_case);
+    transform("random_case", access::random_case);
+    transform("random_single_case", access::random_single_case);
+    transform("format", access::format);
+
+    measure("leetify", 1'000'000, [&] {
+        nickname.assign(original);
+        (generator.*access::leetify)(nickname, original, false);
+        do_not_optimize(nickname);
+    });
+}
+
+// Generation cost with a growing amount of threads sharing one generator,
+// as the wall time per nickname generated by every thread together.
+void bench_threads()
+{
+    const auto& generator{dasmig::nng::instance()};
+
+    const dasmig::prepared_name name{L"Alberto Bins Elis"};
+
+    for (std::size_t threads : {1, 2, 4, 8})
+    {
+        // Nicknames generated by each thread.
+        constexpr std::size_t per_thread{50'000};
+
+        const std::string label{"get_nickname(prepared_name) " +
+                                std::to_string(threads) + " threads"};
+
+        measure(
+            label.c_str(), 1,
+            [&] {
+                std::vector<std::jthread> workers;
+
+                for (std::size_t i{0}; i < threads; i++)
+                {
+                    workers.emplace_back([&] {
+                        for (std::size_t j{0}; j < per_thread; j++)
+                        {
+                            do_not_optimize(generator.get_nickname(name));
+                        }
+                    });
+                }
+            },
+            threads * per_thread);
+    }
+}
+
+#ifdef DASMIG_NNG_STATS
+// Time taken by each generation stage of the shared generator, recorded by
+// the statistics build of the benchmarks.
+void bench_stats()
+{
+    const dasmig::generation_stats stats{dasmig::nng::instance().stats()};
+
+    for (const auto& [stage, latency] : stats.latencies)
+    {
+        const std::string label{"stage " + std::string{stage} + " p50/p99"};
+
+        std::printf("%-48s %12lld ns %12lld ns\n", label.c_str(),
+                    static_cast<long long>(latency.percentile(0.5).count()),
+                    static_cast<long long>(latency.percentile(0.99).count()));
+    }
+}
+#endif
+
+// Runs every benchmark, the largest corpus only when called with --large.
+int main(int argc, char* argv[])
+{
+    // Whether the ten million words corpus is measured as well.
+    const bool large{(argc > 1) && (std::string_view{argv[1]} == "--large")};
+
+    // Scratch folder holding the synthetic wordlists.
+    const std::filesystem::path workspace{
+        std::filesystem::temp_directory_path() / "nng_benchmark"};
+
+    std::filesystem::remove_all(workspace);
+
+    bench_wordlist_size(workspace);
+    bench_weighted(workspace);
+    bench_compiled_load(workspace);
+    bench_utf8_load(workspace);
+    bench_parallel_load(workspace);
+    bench_corpora(workspace, large);
+    bench_batch();
+    bench_stages();
+    bench_threads();
+    bench_character_traits();
+    bench_kernels();
+    bench_engines(workspace);
+    bench_unique(workspace);
+    bench_reserved(workspace);
+#ifdef DASMIG_NNG_STATS
+    bench_stats();
+#endif
+
+    std::filesystem::remove_all(workspace);
+
+    return 0;
+}
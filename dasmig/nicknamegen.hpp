@@ -1,20 +1,48 @@
-#include "random.hpp"
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <cwctype>
+#include <exception>
 #include <filesystem>
 #include <fstream>
 #include <functional>
 #include <iostream>
-#include <list>
-#include <map>
+#include <limits>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <optional>
-#include <sstream>
+#include <random>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <utility>
 #include <variant>
 #include <vector>
 
+#if defined(__x86_64__) && (__SIZEOF_WCHAR_T__ == 4)
+#include <immintrin.h>
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// Defining DASMIG_NNG_STATS before including the header records generation
+// statistics, which are otherwise compiled out and always empty.
+
 // Written by Diego Dasso Migotto - diegomigotto at hotmail dot com
 namespace dasmig
 {
@@ -24,764 +52,4637 @@ namespace dasmig
 class nickname
 {
   public:
+    // Allocator of the nickname memory, allowing containers using memory
+    // resources to hand their resource to each nickname.
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    // Empty nickname, allows containers of nicknames to be reused when
+    // generating nicknames in batches.
+    nickname() = default;
+
+    // Empty nickname taking its memory from the allocator.
+    explicit nickname(const allocator_type& allocator) : _strings(allocator)
+    {
+    }
+
+    // Copies and moves keep the allocator, except when one is received.
+    nickname(const nickname&) = default;
+    nickname(nickname&&) noexcept = default;
+    nickname& operator=(const nickname&) = default;
+    nickname& operator=(nickname&&) = default;
+    ~nickname() = default;
+
+    // Copy of the nickname taking its memory from the allocator.
+    nickname(const nickname& other, const allocator_type& allocator)
+        : _strings(other._strings, allocator),
+          _nickname_size(other._nickname_size)
+    {
+    }
+
+    // Moves the nickname, copying it when the allocators differ.
+    nickname(nickname&& other, const allocator_type& allocator)
+        : _strings(std::move(other._strings), allocator),
+          _nickname_size(other._nickname_size)
+    {
+    }
+
+    // Allocator of the nickname memory.
+    [[nodiscard]] allocator_type get_allocator() const
+    {
+        return _strings.get_allocator();
+    }
+
     // Return original word used as source for the nickname, or name that
     // originated it.
     [[nodiscard]] std::wstring plain() const
     {
-        return _original_string;
+        return std::wstring{std::wstring_view{_strings}.substr(_nickname_size)};
     }
 
     // Operator wstring to allow for implicit conversion to string.
     operator std::wstring() const // NOLINT(hicpp-explicit-conversions)
     {
-        return _internal_string;
+        return std::wstring{view()};
+    }
+
+    // View of the nickname, valid until the nickname changes.
+    [[nodiscard]] std::wstring_view view() const
+    {
+        return std::wstring_view{_strings}.substr(0, _nickname_size);
     }
 
     // Operator ostream streaming internal string.
     friend std::wostream& operator<<(std::wostream& wos,
                                      const nickname& nickname)
     {
-        wos << nickname._internal_string;
+        wos << nickname.view();
         return wos;
     }
 
   private:
-    // Private constructor, this is mostly a helper class to the nickname
-    // generator, not the intended API.
-    nickname(std::wstring nickname_str, std::wstring original_str)
-        : _internal_string(std::move(nickname_str)),
-          _original_string(std::move(original_str))
-    {
-    }
+    // Current nickname after all modifications/formatting, followed by the
+    // original string used to generate it, sharing a single allocation.
+    std::pmr::wstring _strings;
 
-    // Current nickname after all modifications/formatting.
-    std::wstring _internal_string;
-
-    // Original string used to generated the nickname.
-    std::wstring _original_string;
+    // Size of the current nickname at the beginning of the strings.
+    std::size_t _nickname_size{0};
 
     // Allows nickname generator to construct nicknames.
-    friend class nng;
+    template <typename Engine> friend class basic_nng;
 };
 
-// The nickname generator generates as realistic as possible gamers nicknames
-// akin to professional players, allowing requests specifying the player name.
-class nng
+// Player name split into each name/surname, allowing many nicknames to be
+// generated for the same player without parsing the name every time. Every
+// part of the name based nicknames that doesn't depend on chance is cached
+// when preparing the name. The prepared name is immutable and shared by
+// copies, which can be used by multiple threads at once.
+class prepared_name
 {
   public:
-    // Copy/move constructors can be deleted since they are not going to be
-    // used due to singleton pattern.
-    nng(const nng&) = delete;
-    nng(nng&&) = delete;
-    nng& operator=(const nng&) = delete;
-    nng& operator=(nng&&) = delete;
+    // Empty name, nicknames are generated from the word lists instead.
+    prepared_name() = default;
+
+    // Splits the received full name into each name/surname.
+    explicit prepared_name(std::wstring_view name);
 
-    // Thread safe access to nickname generator singleton.
-    static nng& instance()
+    // Splits the received full name, taking every allocation from the
+    // memory resource.
+    prepared_name(std::wstring_view name, std::pmr::memory_resource* resource);
+
+    // Full name, including spaces.
+    [[nodiscard]] std::wstring_view full() const
     {
-        static nng instance;
-        return instance;
+        return _parsed ? _parsed->name : std::wstring_view{};
     }
 
-    // Generates a nickname based on requested name(optional).
-    [[nodiscard]] nickname get_nickname(const std::wstring& name = L"") const
+    // Each name/surname composing the full name.
+    [[nodiscard]] std::span<const std::wstring_view> parts() const
     {
-        return solver(name);
-    };
+        return _parsed ? std::span{_parsed->views.data(), _parsed->part_count}
+                       : std::span<const std::wstring_view>{};
+    }
 
-    // Try loading every possible wordlists file from the received resource
-    // path.
-    void load(const std::filesystem::path& resource_path)
+    // Whether there's no name to generate nicknames from.
+    [[nodiscard]] bool empty() const
     {
-        if (std::filesystem::exists(resource_path) &&
-            std::filesystem::is_directory(resource_path))
-        {
-            for (const auto& entry :
-                 std::filesystem::recursive_directory_iterator(resource_path))
-            {
-                if (entry.is_regular_file() &&
-                    (entry.path().extension() == ".words"))
-                {
-                    parse_file(entry);
-                }
-            }
-        };
+        return parts().empty();
     }
 
   private:
-    // Container of words.
-    using word_container = std::vector<std::wstring>;
+    // Full name, its parts and every cached strategy result.
+    struct parsed
+    {
+        // Empty parsed name taking its memory from the resource.
+        explicit parsed(std::pmr::memory_resource* resource)
+            : characters(resource), views(resource)
+        {
+        }
 
-    // Container of methods used to modify the nickname.
-    using generators =
-        std::vector<std::function<std::wstring(const std::wstring&)>>;
+        // Full name followed by every cached strategy result.
+        std::pmr::wstring characters;
 
-    // Default folder to look for wordlists resources.
-    static const inline std::filesystem::path _default_resources_path{
-        R"(C:\Repos\nickname-generator\resources\)"};
+        // Full name, including spaces.
+        std::wstring_view name;
 
-    // Contains all vowel characters.
-    static const inline std::wstring _vowels{
-        L"aeiouáàâãäåæçèéêëìíîïðñòóôõöøšùúûüýÿ"};
+        // Each name/surname composing the full name, followed by each of them
+        // reduced to their consonants.
+        std::pmr::vector<std::wstring_view> views;
 
-    // Contains all vowel characters.
-    static const inline std::map<wchar_t, wchar_t> _leet_map{
-        {L'o', L'0'}, {L'O', L'0'}, {L'i', L'1'}, {L'I', L'1'}, {L's', L'2'},
-        {L'S', L'2'}, {L'e', L'3'}, {L'E', L'3'}, {L'a', L'4'}, {L'A', L'4'},
-        {L'g', L'6'}, {L'G', L'6'}, {L't', L'7'}, {L'T', L'7'}, {L'b', L'8'},
-        {L'B', L'8'}, {L'q', L'9'}, {L'Q', L'9'}};
+        // Amount of names/surnames composing the full name.
+        std::size_t part_count{0};
 
-    // Vector for randomly accessing wordlists.
-    std::vector<word_container> _wordlists;
+        // First letter of each name/surname.
+        std::wstring_view initials;
 
-    // Initialize random generator, no complicated processes.
-    nng()
-    {
-        load(_default_resources_path);
+        // First name followed by the last surname initial.
+        std::wstring_view first_plus_initial;
+
+        // First name initial followed by the last surname.
+        std::wstring_view initial_plus_last;
     };
 
-    // We don't manage any resource, all should gracefully deallocate by itself.
-    ~nng() = default;
+    // Parsed name shared by every copy.
+    std::shared_ptr<const parsed> _parsed;
 
-    // Add an x to either the front or back of the nickname - or both.
-    static std::wstring xfy(const std::wstring& nickname)
+    // Allows nickname generator to parse names and read cached results.
+    template <typename Engine> friend class basic_nng;
+};
+
+// Internal class used by nickname generator to draw positions according to
+// their integer weights in constant time through a Walker alias table, built
+// at runtime. Each column keeps its own position with probability
+// threshold / 2^32 and gives the rest to its alias, both stored side by side
+// so a draw touches a single cache line. The table is either owned or mapped
+// from a compiled file, an empty table draws uniformly.
+class weighted_index
+{
+  public:
+    // Uniform draws.
+    weighted_index() = default;
+
+    // Builds the table from the weight of each position, equal weights are
+    // drawn uniformly without any table.
+    explicit weighted_index(std::span<const std::uint32_t> weights)
     {
-        // Xfied nickname.
-        std::wstring x_nickname{nickname};
+        if (std::adjacent_find(weights.begin(), weights.end(),
+                               std::not_equal_to<>{}) == weights.end())
+        {
+            return;
+        }
 
-        // Distribution of possible xy, yx, xyx probability.
-        switch (effolkronium::random_thread_local::get(0, 2))
+        // Sum of every weight.
+        double total{0};
+
+        for (const auto& weight : weights)
         {
-        case 0:
-            x_nickname.push_back(L'X');
-            break;
-        case 1:
-            x_nickname.insert(0, 1, L'X');
-            break;
-        case 2:
-            x_nickname.push_back(L'X');
-            x_nickname.insert(0, 1, L'X');
-            break;
-        default:
-            break;
+            total += weight;
         }
 
-        return x_nickname;
-    }
+        // Heap allocated storage keeps views valid when the table is moved,
+        // holding the threshold and alias of each column.
+        auto storage{
+            std::make_shared<std::vector<std::uint32_t>>(weights.size() * 2)};
 
-    // Writes the nickname backwards such as emankcin.
-    static std::wstring reverse(const std::wstring& nickname)
-    {
-        // Original nickname reversed.
-        std::wstring reverse_nickname{nickname};
+        // Part of each column belonging to its own position, scaled so the
+        // average column is exactly full.
+        std::vector<double> scaled(weights.size());
 
-        std::reverse(std::begin(reverse_nickname), std::end(reverse_nickname));
+        // Columns less than full and more than full.
+        std::vector<std::uint32_t> small;
+        std::vector<std::uint32_t> large;
 
-        return reverse_nickname;
-    }
+        for (std::size_t i{0}; i < weights.size(); i++)
+        {
+            scaled[i] = weights[i] * static_cast<double>(weights.size()) /
+                        total;
+            (scaled[i] < 1 ? small : large)
+                .push_back(static_cast<std::uint32_t>(i));
+        }
 
-    // Adds an y to the end of nickname or replace the last character if it's a
-    // vowel.
-    static std::wstring yfy(const std::wstring& nickname)
-    {
-        // Nickname with an y a the end.
-        std::wstring nicknamy{nickname};
+        // Threshold and alias of each column.
+        std::uint32_t* table{storage->data()};
+
+        // Scale of a full column.
+        const double full{4294967296.0};
 
-        if (std::find(std::cbegin(_vowels), std::cend(_vowels),
-                      nickname.back()) != std::end(_vowels))
+        while (!small.empty() && !large.empty())
         {
-            nicknamy.back() = L'y';
+            // Column being completed and column completing it.
+            const std::uint32_t less{small.back()};
+            const std::uint32_t more{large.back()};
+
+            small.pop_back();
+            table[2 * less] = static_cast<std::uint32_t>(scaled[less] * full);
+            table[(2 * less) + 1] = more;
+
+            // The larger column fills the rest of the smaller one.
+            scaled[more] -= 1 - scaled[less];
+
+            if (scaled[more] < 1)
+            {
+                large.pop_back();
+                small.push_back(more);
+            }
         }
-        else
+
+        // Columns left are full up to rounding errors, never using an alias.
+        small.insert(small.end(), large.begin(), large.end());
+
+        for (const auto& column : small)
         {
-            nicknamy.push_back(L'y');
+            table[2 * column] = (std::numeric_limits<std::uint32_t>::max)();
+            table[(2 * column) + 1] = column;
         }
 
-        return nicknamy;
+        _table = table;
+        _owner = std::move(storage);
     }
 
-    // Adds a number to the end of nickname.
-    static std::wstring numify(const std::wstring& nickname)
+    // Views a table stored elsewhere, which is kept alive by the owner.
+    weighted_index(const std::uint32_t* table,
+                   std::shared_ptr<const void> owner)
+        : _table(table), _owner(std::move(owner))
     {
-        // Nickname with an y a the end.
-        std::wstring nickname_with_number{nickname};
+    }
 
-        // Utilized to randomize digit added to the end of the nickname.
-        nickname_with_number.push_back(
-            effolkronium::random_thread_local::get(1, 9));
+    // Whether positions are drawn uniformly.
+    [[nodiscard]] bool empty() const
+    {
+        return _table == nullptr;
+    }
 
-        // Append n zeroes to the end of the nickname.
-        for (std::size_t i{0}; i < effolkronium::random_thread_local::get(0, 3);
-             i++)
-        {
-            nickname_with_number.push_back('0');
-        }
+    // Position drawn from the uniformly drawn column and a uniformly drawn
+    // fraction of it.
+    [[nodiscard]] std::size_t pick(std::size_t column,
+                                   std::uint32_t fraction) const
+    {
+        return (fraction < _table[2 * column]) ? column
+                                               : _table[(2 * column) + 1];
+    }
 
-        return nickname_with_number;
+    // Threshold and alias of each column, side by side.
+    [[nodiscard]] const std::uint32_t* table() const
+    {
+        return _table;
     }
 
-    // Adds a trace to the end of the nickname.
-    static std::wstring tracefy(const std::wstring& nickname)
+  private:
+    // Threshold and alias of each column, side by side.
+    const std::uint32_t* _table{nullptr};
+
+    // Keeps the memory viewed by the table alive.
+    std::shared_ptr<const void> _owner;
+};
+
+// Internal class used by nickname generator to access a list of words laid
+// out back to back in a single buffer, each word being accessed as a view into
+// it. The buffer is either owned by the list or mapped from a compiled file.
+class wordlist
+{
+  public:
+    // Empty list.
+    wordlist() = default;
+
+    // Takes ownership of the words laid out back to back and of the position
+    // where each word starts, followed by the end of the last word.
+    wordlist(std::wstring characters, std::vector<std::uint32_t> offsets)
     {
-        return nickname + L"-";
+        // Heap allocated storage keeps views valid when the list is moved.
+        auto storage{std::make_shared<
+            std::pair<std::wstring, std::vector<std::uint32_t>>>(
+            std::move(characters), std::move(offsets))};
+
+        _characters = storage->first.data();
+        _offsets = storage->second.data();
+        _size = storage->second.size() - 1;
+        _owner = std::move(storage);
     }
 
-    // Adds an ing to the end of nickname or replace the last character if it's
-    // a vowel.
-    static std::wstring ingify(const std::wstring& nickname)
+    // Takes ownership of the words, drawn according to the table.
+    wordlist(std::wstring characters, std::vector<std::uint32_t> offsets,
+             weighted_index weights)
+        : wordlist(std::move(characters), std::move(offsets))
+    {
+        _weights = std::move(weights);
+    }
+
+    // Views words stored elsewhere, which are kept alive by the owner.
+    wordlist(const wchar_t* characters, const std::uint32_t* offsets,
+             std::size_t size, std::shared_ptr<const void> owner,
+             weighted_index weights = {})
+        : _characters(characters), _offsets(offsets), _size(size),
+          _owner(std::move(owner)), _weights(std::move(weights))
+    {
+    }
+
+    // Returns a view of the word at the received position.
+    [[nodiscard]] std::wstring_view operator[](std::size_t index) const
+    {
+        return {_characters + _offsets[index],
+                _offsets[index + 1] - _offsets[index]};
+    }
+
+    // Amount of words in the list.
+    [[nodiscard]] std::size_t size() const
+    {
+        return _size;
+    }
+
+    // Whether the list contains no words.
+    [[nodiscard]] bool empty() const
+    {
+        return _size == 0;
+    }
+
+    // Every word of the list laid out back to back.
+    [[nodiscard]] std::wstring_view characters() const
+    {
+        return {_characters, empty() ? 0 : _offsets[_size]};
+    }
+
+    // Position where each word starts, followed by the end of the last word.
+    [[nodiscard]] const std::uint32_t* offsets() const
+    {
+        return _offsets;
+    }
+
+    // Table drawing each word according to its weight, empty when every word
+    // is equally likely.
+    [[nodiscard]] const weighted_index& weights() const
+    {
+        return _weights;
+    }
+
+  private:
+    // First character of the first word.
+    const wchar_t* _characters{nullptr};
+
+    // Position where each word starts, followed by the end of the last word.
+    const std::uint32_t* _offsets{nullptr};
+
+    // Amount of words in the list.
+    std::size_t _size{0};
+
+    // Keeps the memory viewed by the list alive.
+    std::shared_ptr<const void> _owner;
+
+    // Table drawing each word according to its weight.
+    weighted_index _weights;
+};
+
+// Conversions between UTF-8 text and native wide strings, which are UTF-16
+// where wchar_t is two bytes long and UTF-32 otherwise. Used by the nickname
+// generator and its tools alike.
+class utf8
+{
+  public:
+    // Decodes the UTF-8 sequence starting at the received position, moving
+    // past it. Invalid sequences decode to U+FFFD, consuming their longest
+    // valid prefix or a single byte.
+    static char32_t decode(std::span<const unsigned char> text,
+                           std::size_t& position)
     {
-        // Nickname with an ing a the end.
-        std::wstring nicknaming{nickname};
+        // Character used for invalid sequences.
+        const char32_t replacement{0xFFFD};
+
+        // Byte starting the sequence.
+        const unsigned char lead{text[position++]};
+
+        // Amount of bytes following the lead byte.
+        std::size_t continuations{0};
 
-        if (std::find(std::cbegin(_vowels), std::cend(_vowels),
-                      nickname.back()) != std::end(_vowels))
+        // Code point bits carried by the lead byte.
+        char32_t code_point{0};
+
+        // Bounds of the first continuation byte, excluding overlong
+        // sequences, surrogates and code points past U+10FFFF.
+        unsigned char lowest{0x80};
+        unsigned char highest{0xBF};
+
+        if ((lead >= 0xC2) && (lead <= 0xDF))
+        {
+            continuations = 1;
+            code_point = lead & 0x1F;
+        }
+        else if ((lead >= 0xE0) && (lead <= 0xEF))
         {
-            nicknaming.back() = L'i';
-            nicknaming.push_back(L'n');
-            nicknaming.push_back(L'g');
+            continuations = 2;
+            code_point = lead & 0x0F;
+            lowest = (lead == 0xE0) ? 0xA0 : 0x80;
+            highest = (lead == 0xED) ? 0x9F : 0xBF;
+        }
+        else if ((lead >= 0xF0) && (lead <= 0xF4))
+        {
+            continuations = 3;
+            code_point = lead & 0x07;
+            lowest = (lead == 0xF0) ? 0x90 : 0x80;
+            highest = (lead == 0xF4) ? 0x8F : 0xBF;
         }
         else
         {
-            nicknaming.push_back(L'i');
-            nicknaming.push_back(L'n');
-            nicknaming.push_back(L'g');
+            return replacement;
+        }
+
+        for (; continuations > 0; continuations--)
+        {
+            if ((position == text.size()) || (text[position] < lowest) ||
+                (text[position] > highest))
+            {
+                return replacement;
+            }
+
+            code_point = (code_point << 6) | (text[position++] & 0x3F);
+            lowest = 0x80;
+            highest = 0xBF;
         }
 
-        return nicknaming;
+        return code_point;
     }
 
-    // Finds an aeio vowel and duplicates it, returns same nickname if no
-    // available vowel.
-    static std::wstring duovowel(const std::wstring& nickname)
+    // Writes the code point as native wide characters, returns how many.
+    static std::size_t write_wide(wchar_t* output, char32_t code_point)
     {
-        static const std::wstring simple_vowels = L"aeio";
+        if ((sizeof(wchar_t) == 2) && (code_point >= 0x10000))
+        {
+            output[0] =
+                static_cast<wchar_t>(0xD800 + ((code_point - 0x10000) >> 10));
+            output[1] =
+                static_cast<wchar_t>(0xDC00 + ((code_point - 0x10000) & 0x3FF));
+            return 2;
+        }
 
-        // Nickname with duplicated vowel.
-        std::wstring nicknamee{nickname};
+        output[0] = static_cast<wchar_t>(code_point);
+        return 1;
+    }
 
-        // Try duplicating each vowel in the nickname, stop after succeeding
-        // once.
-        for (const auto& vowel : simple_vowels)
+    // Reads the code point of the native wide characters starting at the
+    // received position, moving past it.
+    static char32_t read_wide(std::wstring_view characters,
+                              std::size_t& position)
+    {
+        // Code point starting at the current character.
+        auto code_point{static_cast<char32_t>(characters[position++])};
+
+        // Joins surrogate pairs where wide characters are UTF-16.
+        if ((sizeof(wchar_t) == 2) && (code_point >= 0xD800) &&
+            (code_point <= 0xDBFF) && (position < characters.size()) &&
+            (characters[position] >= 0xDC00) &&
+            (characters[position] <= 0xDFFF))
         {
-            // Iterator pointing to vowel finded in the nickname.
-            const auto vowel_iterator =
-                std::find(std::cbegin(nicknamee), std::cend(nicknamee), vowel);
-
-            if (vowel_iterator != std::cend(nicknamee))
-            {
-                nicknamee.insert(vowel_iterator, *vowel_iterator);
-                break;
-            }
+            code_point = 0x10000 + ((code_point - 0xD800) << 10) +
+                         (static_cast<char32_t>(characters[position++]) -
+                          0xDC00);
         }
 
-        return nicknamee;
+        return code_point;
     }
 
-    // Replaces a letter by a numerical character.
-    static std::wstring oneleet(const std::wstring& nickname)
+    // Appends the UTF-8 text decoded as native wide characters.
+    static void decode(std::wstring& output, std::string_view text)
     {
-        // Nickname with leetified letter.
-        std::wstring leet_nickname{nickname};
+        // Bytes of the text.
+        const std::span<const unsigned char> bytes{
+            reinterpret_cast<const unsigned char*>(text.data()), text.size()};
 
-        // Candidates letter to be leetified.
-        std::list<wchar_t> candidates{};
+        // Wide characters of a single code point.
+        std::array<wchar_t, 2> units{};
 
-        // Retrieve candidates for replacement.
-        for (auto& character : leet_nickname)
+        for (std::size_t i{0}; i < bytes.size();)
         {
-            if (_leet_map.contains(character))
+            if (bytes[i] < 0x80)
             {
-                candidates.push_back(character);
+                output.push_back(static_cast<wchar_t>(bytes[i++]));
+            }
+            else
+            {
+                output.append(units.data(),
+                              write_wide(units.data(), decode(bytes, i)));
             }
         }
-
-        return leet_nickname;
     }
 
-    // Replaces as much letters as possible in the nickname by numerical
-    // characters.
-    static std::wstring allleet(const std::wstring& nickname)
+    // Appends the UTF-8 encoding of the native wide characters.
+    static void encode(std::string& output, std::wstring_view characters)
     {
-        // Nickname leetified.
-        std::wstring leet_nickname{nickname};
-
-        // Replace all possible characters.
-        for (auto& character : leet_nickname)
+        for (std::size_t i{0}; i < characters.size();)
         {
-            if (_leet_map.contains(character))
+            // Code point being encoded.
+            const char32_t code_point{read_wide(characters, i)};
+
+            if (code_point < 0x80)
             {
-                character = _leet_map.at(character);
+                output.push_back(static_cast<char>(code_point));
+            }
+            else if (code_point < 0x800)
+            {
+                output.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+                output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+            }
+            else if (code_point < 0x10000)
+            {
+                output.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+                output.push_back(
+                    static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+                output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+            }
+            else
+            {
+                output.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+                output.push_back(
+                    static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+                output.push_back(
+                    static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+                output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
             }
         }
-
-        return leet_nickname;
     }
+};
 
-    // Slightly modify the nickname to add some flavor.
-    // NOLINTNEXTLINE(misc-no-recursion)
-    static nickname leetify(nickname nickname, bool force = false)
+// Internal class used by nickname generator to map a read only file into
+// memory for as long as the object lives.
+class mapped_file
+{
+  public:
+    // Maps the whole file, throws if it can't be opened or mapped.
+    explicit mapped_file(const std::filesystem::path& file)
+        : _size(std::filesystem::file_size(file))
     {
-        // We have 1/2 chance of leetifying, force parameter overrides this.
-        if (force || effolkronium::random_thread_local::get<bool>())
+        // Nothing to map, some systems refuse mapping empty files.
+        if (_size == 0)
         {
-            // When leetifying, there's 1/2 chance of using a finalizer or a
-            // random leetifier.
-            if (effolkronium::random_thread_local::get<bool>())
-            {
-                // Possible methods utilized to leetify the nickname.
-                static const generators possible_generators{
-                    reverse,  // emanckin
-                    duovowel, // nicknamee
-                    oneleet,  // n1ckname
-                    allleet   // n1ckn4m3
-                };
+            return;
+        }
 
-                // New leetified nickname.
-                nickname._internal_string =
-                    (*effolkronium::random_thread_local::get(
-                        possible_generators))(nickname);
+#ifdef _WIN32
+        // File being mapped.
+        HANDLE file_handle{CreateFileW(file.c_str(), GENERIC_READ,
+                                       FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                       FILE_ATTRIBUTE_NORMAL, nullptr)};
 
-                // If the new nickname didn't suffer any alteration, force
-                // leetify again.
-                return leetify(nickname, nickname._internal_string ==
-                                             nickname._original_string);
-            }
+        if (file_handle == INVALID_HANDLE_VALUE)
+        {
+            throw(std::runtime_error("Unable to open mapped file"));
+        }
 
-            // Possible methods utilized to leetify the nickname.
-            static const generators possible_generators{
-                xfy,     // nicknameX
-                reverse, // emanckin
-                yfy,     // nicknamy
-                numify,  // nickname2000
-                tracefy, // nickname-
-                ingify,  // nicknaming
-            };
+        // Mapping object backing the view, the view keeps it referenced.
+        HANDLE mapping_handle{CreateFileMappingW(file_handle, nullptr,
+                                                 PAGE_READONLY, 0, 0, nullptr)};
 
-            // New leetified nickname.
-            nickname._internal_string =
-                (*effolkronium::random_thread_local::get(possible_generators))(
-                    nickname);
+        CloseHandle(file_handle);
+
+        if (mapping_handle == nullptr)
+        {
+            throw(std::runtime_error("Unable to map file"));
         }
 
-        return nickname;
-    };
+        _data = static_cast<const std::byte*>(
+            MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0));
 
-    // Returns the nickname with an underscore separating its original parts.
-    static std::wstring snake_case(const std::wstring& name)
-    {
-        // Name containing underscore.
-        std::wstring snakefied_name{name};
+        CloseHandle(mapping_handle);
 
-        // Introduce an underscore if it's the begginning of a part of the
-        // nickname, except the first.
-        for (std::size_t i = 1; i < snakefied_name.size(); i++)
+        if (_data == nullptr)
         {
-            if (iswupper(snakefied_name.at(i)) != 0)
-            {
-                snakefied_name.insert(i, L"_");
-                i++;
-            }
+            throw(std::runtime_error("Unable to map file"));
         }
+#else
+        // File being mapped, the mapping keeps it referenced.
+        const int file_descriptor{::open(file.c_str(), O_RDONLY | O_CLOEXEC)};
 
-        return snakefied_name;
-    };
+        if (file_descriptor == -1)
+        {
+            throw(std::runtime_error("Unable to open mapped file"));
+        }
 
-    // Returns the nickname in all uppercase.
-    static std::wstring upper_case(const std::wstring& name)
-    {
-        // Name in all upper case characters.
-        std::wstring upper_name{name};
+        void* mapping{
+            ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0)};
 
-        // Transform every character to uppercase if possible.
-        std::for_each(
-            std::begin(upper_name), std::end(upper_name),
-            [](wchar_t& character) { character = std::towupper(character); });
+        ::close(file_descriptor);
 
-        return upper_name;
-    };
+        if (mapping == MAP_FAILED)
+        {
+            throw(std::runtime_error("Unable to map file"));
+        }
 
-    // Returns the nickname in all lowercase.
-    static std::wstring lower_case(const std::wstring& name)
-    {
-        // Name in all lower case characters.
-        std::wstring lower_name{name};
+        _data = static_cast<const std::byte*>(mapping);
+#endif
+    }
 
-        // Transform every character to lower if possible.
-        std::for_each(
-            std::begin(lower_name), std::end(lower_name),
-            [](wchar_t& character) { character = std::towlower(character); });
+    // Mapped memory can't be shared between objects.
+    mapped_file(const mapped_file&) = delete;
+    mapped_file(mapped_file&&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+    mapped_file& operator=(mapped_file&&) = delete;
 
-        return lower_name;
-    };
+    // Unmaps the file.
+    ~mapped_file()
+    {
+        if (_data != nullptr)
+        {
+#ifdef _WIN32
+            UnmapViewOfFile(_data);
+#else
+            ::munmap(const_cast<std::byte*>(_data), _size);
+#endif
+        }
+    }
 
-    // Returns the nickname in title case.
-    static std::wstring title_case(const std::wstring& name)
+    // First byte of the file.
+    [[nodiscard]] const std::byte* data() const
     {
-        // Well, titlecase is actually the default.
-        return name;
-    };
+        return _data;
+    }
 
-    // Returns the nickname in sentence case.
-    static std::wstring sentence_case(const std::wstring& name)
+    // Size of the file in bytes.
+    [[nodiscard]] std::size_t size() const
     {
-        // Sentence case formatted nickname.
-        std::wstring sentence_name{lower_case(name)};
+        return _size;
+    }
 
-        // Transform the first character to upper case.
-        sentence_name.at(0) = std::towupper(sentence_name.at(0));
+  private:
+    // First byte of the mapped file.
+    const std::byte* _data{nullptr};
 
-        return sentence_name;
-    };
+    // Size of the mapped file in bytes.
+    std::size_t _size;
+};
 
-    // Returns the nickname in camel case.
-    static std::wstring camel_case(const std::wstring& name)
+// Internal class used by nickname generator to remember the hashes of the
+// nicknames it issued. Hashes are split between shards, each one an open
+// addressing table guarded by its own lock, so threads rarely contend. Two
+// nicknames sharing a hash are treated as the same, which can only reject a
+// nickname that was never issued, never issue one twice.
+class hash_set
+{
+  public:
+    // Inserts the hash, returns whether it wasn't already present.
+    bool insert(std::uint64_t hash)
     {
-        // Camel case formatted nickname.
-        std::wstring camel_name{name};
+        // Zero marks empty slots, its hash is stored as one instead.
+        hash = (hash == 0) ? 1 : hash;
 
-        // Transform the first character to lower case.
-        camel_name.at(0) = std::towlower(camel_name.at(0));
+        // Shard responsible for the hash, chosen by its highest bits.
+        shard& owner{_shards[hash >> (64 - _shard_bits)]};
 
-        return camel_name;
-    };
+        const std::lock_guard lock{owner.guard};
 
-    // Returns the nickname in reverse sentence case.
-    static std::wstring reverse_sentence_case(const std::wstring& name)
-    {
-        // Reverse sentence case formatted nickname.
-        std::wstring rsentence_name{lower_case(name)};
+        // Tables are kept at most half full.
+        if ((owner.size + 1) * 2 > owner.slots.size())
+        {
+            grow(owner);
+        }
 
-        // Transform the last character to upper case.
-        rsentence_name.back() = std::towupper(rsentence_name.back());
+        // Slot where the hash is stored, or would be.
+        std::uint64_t& slot{owner.slots[find(owner.slots, hash)]};
 
-        return rsentence_name;
-    };
+        if (slot == hash)
+        {
+            return false;
+        }
 
-    // Returns the nickname in bathtub case.
-    static std::wstring bathtub_case(const std::wstring& name)
+        slot = hash;
+        owner.size++;
+
+        return true;
+    }
+
+    // Whether the hash is present.
+    [[nodiscard]] bool contains(std::uint64_t hash) const
     {
-        // Bathtub case formatted nickname.
-        std::wstring bathtub_name{lower_case(name)};
+        hash = (hash == 0) ? 1 : hash;
 
-        // Transform the first character to upper case.
-        bathtub_name.at(0) = std::towupper(bathtub_name.at(0));
+        // Shard responsible for the hash, chosen by its highest bits.
+        const shard& owner{_shards[hash >> (64 - _shard_bits)]};
 
-        // Transform the last character to upper case.
-        bathtub_name.back() = std::towupper(bathtub_name.back());
+        const std::lock_guard lock{owner.guard};
 
-        return bathtub_name;
-    };
+        return !owner.slots.empty() &&
+               (owner.slots[find(owner.slots, hash)] == hash);
+    }
 
-    // Returns the nickname in winding case.
-    static std::wstring winding_case(const std::wstring& name)
+    // Amount of hashes present.
+    [[nodiscard]] std::size_t size() const
     {
-        // Winding case formatted nickname.
-        std::wstring winding_name{lower_case(name)};
+        // Sum of every shard size.
+        std::size_t total{0};
 
-        // Transform to uppercase half of the letters.
-        for (std::size_t i = 0; i < winding_name.size(); i++)
+        for (const auto& owner : _shards)
         {
-            if ((i % 2) == 0)
-            {
-                winding_name.at(i) = std::towupper(winding_name.at(i));
-            }
+            const std::lock_guard lock{owner.guard};
+
+            total += owner.size;
         }
 
-        return winding_name;
-    };
+        return total;
+    }
 
-    // Returns the nickname with case in a random fashion.
-    static std::wstring random_case(const std::wstring& name)
+  private:
+    // Table storing the hashes sharing the same highest bits, aligned to
+    // keep the locks of different shards in different cache lines.
+    struct alignas(64) shard
     {
-        // Name in all lower case characters.
-        std::wstring random_name{lower_case(name)};
+        // Serializes every access to the table.
+        mutable std::mutex guard;
 
-        // Transform every character to lower if possible.
-        std::for_each(std::begin(random_name), std::end(random_name),
-                      [&](wchar_t& character) {
-                          if (effolkronium::random_thread_local::get<bool>())
-                          {
-                              character = std::towupper(character);
-                          }
-                      });
+        // Hashes stored by linear probing, zero marking empty slots.
+        std::vector<std::uint64_t> slots;
 
-        return random_name;
+        // Amount of hashes stored.
+        std::size_t size{0};
     };
 
-    // Returns the nickname all lower case with a single random character
-    // uppercase.
-    static std::wstring random_single_case(const std::wstring& name)
+    // Position of the slot holding the hash or of the empty slot where it
+    // belongs.
+    static std::size_t find(const std::vector<std::uint64_t>& slots,
+                            std::uint64_t hash)
     {
-        // Name in all lower case characters.
-        std::wstring random_name{lower_case(name)};
-
-        // Position of single random character to be uppercased.
-        auto random_char{effolkronium::random_thread_local::get(random_name)};
-
-        *random_char = std::towupper(*random_char);
-
-        return random_name;
-    };
+        // Positions wrap around the table, its size is a power of two.
+        const std::size_t mask{slots.size() - 1};
+
+        for (std::size_t i{hash & mask};; i = (i + 1) & mask)
+        {
+            if ((slots[i] == hash) || (slots[i] == 0))
+            {
+                return i;
+            }
+        }
+    }
+
+    // Doubles the shard table, inserting every hash again.
+    static void grow(shard& owner)
+    {
+        // Table being replaced.
+        std::vector<std::uint64_t> previous(
+            std::max<std::size_t>(16, owner.slots.size() * 2));
+
+        previous.swap(owner.slots);
+
+        for (const auto& hash : previous)
+        {
+            if (hash != 0)
+            {
+                owner.slots[find(owner.slots, hash)] = hash;
+            }
+        }
+    }
+
+    // Amount of highest hash bits choosing the shard.
+    static constexpr std::size_t _shard_bits{6};
+
+    // Every shard of the set.
+    std::array<shard, std::size_t{1} << _shard_bits> _shards;
+};
+
+// Internal class used by nickname generator to tell whether a hash belongs to
+// a fixed set of hashes, taking about 2.5 bytes per hash however long the
+// strings hashed. Each hash is matched by a 16 bit fingerprint, so one in
+// 65536 hashes outside the set is wrongly reported as present.
+class xor_filter
+{
+  public:
+    // Empty filter.
+    xor_filter() = default;
+
+    // Builds the filter holding every received hash, in any order and with
+    // any amount of duplicates.
+    explicit xor_filter(std::vector<std::uint64_t> hashes)
+    {
+        std::sort(hashes.begin(), hashes.end());
+        hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+
+        _size = hashes.size();
+
+        if (hashes.empty())
+        {
+            return;
+        }
+
+        _segment_length = (32 + (_size * 123 / 100)) / 3;
+        _fingerprints.resize(3 * _segment_length);
+
+        // Mixed hashes placed in each slot, xored together.
+        std::vector<std::uint64_t> placed(_fingerprints.size());
+
+        // Amount of mixed hashes placed in each slot.
+        std::vector<std::uint32_t> counts(_fingerprints.size());
+
+        // Slots holding a single mixed hash, waiting to be peeled.
+        std::vector<std::size_t> pending;
+
+        // Slot peeled and the mixed hash it held, in peeling order.
+        std::vector<std::pair<std::size_t, std::uint64_t>> peeled;
+
+        pending.reserve(_fingerprints.size());
+        peeled.reserve(_size);
+
+        // Every seed gives another layout, a layout can't always be peeled.
+        while (true)
+        {
+            std::fill(placed.begin(), placed.end(), 0);
+            std::fill(counts.begin(), counts.end(), 0);
+            pending.clear();
+            peeled.clear();
+
+            for (const auto& hash : hashes)
+            {
+                // Hash mixed with the seed.
+                const std::uint64_t mixed{mix(hash)};
+
+                for (const auto& slot : slots(mixed))
+                {
+                    placed[slot] ^= mixed;
+                    counts[slot]++;
+                }
+            }
+
+            for (std::size_t i{0}; i < counts.size(); i++)
+            {
+                if (counts[i] == 1)
+                {
+                    pending.push_back(i);
+                }
+            }
+
+            while (!pending.empty())
+            {
+                // Slot about to be peeled.
+                const std::size_t peeling{pending.back()};
+
+                pending.pop_back();
+
+                if (counts[peeling] != 1)
+                {
+                    continue;
+                }
+
+                // Only mixed hash left in the slot.
+                const std::uint64_t mixed{placed[peeling]};
+
+                peeled.emplace_back(peeling, mixed);
+
+                for (const auto& slot : slots(mixed))
+                {
+                    placed[slot] ^= mixed;
+
+                    if (--counts[slot] == 1)
+                    {
+                        pending.push_back(slot);
+                    }
+                }
+            }
+
+            if (peeled.size() == _size)
+            {
+                break;
+            }
+
+            _seed = _seed * 0x5851F42D4C957F2D + 0x14057B7EF767814F;
+        }
+
+        _build_bytes = (hashes.capacity() * sizeof(std::uint64_t)) +
+                       (placed.capacity() * sizeof(std::uint64_t)) +
+                       (counts.capacity() * sizeof(std::uint32_t)) +
+                       (pending.capacity() * sizeof(std::size_t)) +
+                       (peeled.capacity() *
+                        sizeof(std::pair<std::size_t, std::uint64_t>));
+
+        // Slots assigned last to first, each one is the only slot of its hash
+        // not assigned by a hash peeled after.
+        for (auto it{peeled.rbegin()}; it != peeled.rend(); it++)
+        {
+            // Every slot of the mixed hash, including the peeled one.
+            const auto positions{slots(it->second)};
+
+            _fingerprints[it->first] = 0;
+            _fingerprints[it->first] = static_cast<std::uint16_t>(
+                fingerprint(it->second) ^ _fingerprints[positions[0]] ^
+                _fingerprints[positions[1]] ^ _fingerprints[positions[2]]);
+        }
+    }
+
+    // Whether the hash was among the ones received, or rarely matches the
+    // fingerprint of one of them.
+    [[nodiscard]] bool contains(std::uint64_t hash) const
+    {
+        if (_size == 0)
+        {
+            return false;
+        }
+
+        // Hash mixed with the seed.
+        const std::uint64_t mixed{mix(hash)};
+
+        // Every slot of the mixed hash.
+        const auto positions{slots(mixed)};
+
+        return fingerprint(mixed) ==
+               (_fingerprints[positions[0]] ^ _fingerprints[positions[1]] ^
+                _fingerprints[positions[2]]);
+    }
+
+    // Amount of distinct hashes held.
+    [[nodiscard]] std::size_t size() const
+    {
+        return _size;
+    }
+
+    // Memory taken by the fingerprints.
+    [[nodiscard]] std::size_t bytes() const
+    {
+        return _fingerprints.size() * sizeof(std::uint16_t);
+    }
+
+    // Temporary memory taken while building the filter, received hashes
+    // included.
+    [[nodiscard]] std::size_t build_bytes() const
+    {
+        return _build_bytes;
+    }
+
+  private:
+    // Hash mixed with the seed by the murmur3 finalizer.
+    [[nodiscard]] std::uint64_t mix(std::uint64_t hash) const
+    {
+        hash += _seed;
+        hash = (hash ^ (hash >> 33)) * 0xFF51AFD7ED558CCD;
+        hash = (hash ^ (hash >> 33)) * 0xC4CEB9FE1A85EC53;
+
+        return hash ^ (hash >> 33);
+    }
+
+    // Fingerprint matching the mixed hash.
+    static std::uint16_t fingerprint(std::uint64_t mixed)
+    {
+        return static_cast<std::uint16_t>(mixed ^ (mixed >> 32));
+    }
+
+    // Slot of the mixed hash in each of the three segments.
+    [[nodiscard]] std::array<std::size_t, 3> slots(std::uint64_t mixed) const
+    {
+        // Maps 32 bits of the mixed hash into the segment without division.
+        const auto reduce{[this](std::uint64_t bits) {
+            return static_cast<std::size_t>(
+                (static_cast<std::uint32_t>(bits) * _segment_length) >> 32);
+        }};
+
+        return {reduce(mixed), _segment_length + reduce(std::rotl(mixed, 21)),
+                (2 * _segment_length) + reduce(std::rotl(mixed, 42))};
+    }
+
+    // Seed mixed into every hash, changed until the hashes can be placed.
+    std::uint64_t _seed{0x9E3779B97F4A7C15};
+
+    // Amount of slots in each of the three segments.
+    std::uint64_t _segment_length{0};
+
+    // Amount of distinct hashes held.
+    std::size_t _size{0};
+
+    // Temporary memory taken while building the filter.
+    std::size_t _build_bytes{0};
+
+    // Fingerprint of each slot, the fingerprints of the three slots of a
+    // hash xored together give its own fingerprint.
+    std::vector<std::uint16_t> _fingerprints;
+};
+
+// Distribution of the time taken by a generation stage, in buckets of about
+// 12% of their value. Values below 16 nanoseconds have a bucket each, every
+// following power of two is split into 8 equally wide buckets.
+class latency_histogram
+{
+  public:
+    // Amount of buckets, enough for any 64 bit amount of nanoseconds.
+    static constexpr std::size_t bucket_count{496};
+
+    // Bucket counting the amount of nanoseconds.
+    static std::size_t bucket(std::uint64_t nanoseconds)
+    {
+        if (nanoseconds < 16)
+        {
+            return nanoseconds;
+        }
+
+        // Power of two splitting the amount into its bucket.
+        const std::size_t shift{
+            static_cast<std::size_t>(std::bit_width(nanoseconds)) - 4};
+
+        return 16 + ((shift - 1) * 8) + ((nanoseconds >> shift) & 7);
+    }
+
+    // Smallest amount of nanoseconds counted by the bucket.
+    static std::uint64_t lowest(std::size_t bucket)
+    {
+        if (bucket < 16)
+        {
+            return bucket;
+        }
+
+        return (8 + ((bucket - 16) % 8)) << (((bucket - 16) / 8) + 1);
+    }
+
+    // Amount of times recorded in each bucket.
+    [[nodiscard]] const std::array<std::uint64_t, bucket_count>& buckets()
+        const
+    {
+        return _buckets;
+    }
+
+    // Amount of times recorded.
+    [[nodiscard]] std::uint64_t count() const
+    {
+        return _count;
+    }
+
+    // Smallest time of the bucket reaching the fraction of every time
+    // recorded, zero when there's none.
+    [[nodiscard]] std::chrono::nanoseconds percentile(double fraction) const
+    {
+        // Amount of times that must be reached.
+        const auto target{static_cast<std::uint64_t>(
+            std::ceil(fraction * static_cast<double>(_count)))};
+
+        // Amount of times in the buckets seen so far.
+        std::uint64_t seen{0};
+
+        for (std::size_t i{0}; i < bucket_count; i++)
+        {
+            seen += _buckets[i];
+
+            if ((seen > 0) && (seen >= target))
+            {
+                return std::chrono::nanoseconds{lowest(i)};
+            }
+        }
+
+        return std::chrono::nanoseconds{0};
+    }
+
+    // Adds the amount of times to the bucket.
+    void add(std::size_t bucket, std::uint64_t times)
+    {
+        _buckets[bucket] += times;
+        _count += times;
+    }
+
+  private:
+    // Amount of times recorded in each bucket.
+    std::array<std::uint64_t, bucket_count> _buckets{};
+
+    // Amount of times recorded.
+    std::uint64_t _count{0};
+};
+
+// Statistics of the nickname generator, summed over every thread. Each
+// counter and latency histogram is named after the stage recording it.
+struct generation_stats
+{
+    // Amount of times each strategy, transform or event happened.
+    std::vector<std::pair<std::string_view, std::uint64_t>> counters;
+
+    // Time taken by each generation stage.
+    std::vector<std::pair<std::string_view, latency_histogram>> latencies;
+};
+
+// Counters of the nickname generator uniqueness mode.
+struct uniqueness_stats
+{
+    // Nicknames issued while the uniqueness mode was enabled.
+    std::uint64_t issued{0};
+
+    // Nicknames generated and discarded for having been issued before or
+    // being reserved.
+    std::uint64_t retries{0};
+};
+
+// Time taken by the nickname generator to load a single wordlists file,
+// reported for every file read by each load.
+struct file_load
+{
+    // Loaded file.
+    std::filesystem::path file;
+
+    // Amount of words read from the file.
+    std::size_t words{0};
+
+    // Time spent reading the file.
+    std::chrono::nanoseconds duration{0};
+};
+
+// Result of the nickname generator reading a file of reserved nicknames.
+struct reserved_load
+{
+    // Loaded file.
+    std::filesystem::path file;
+
+    // Amount of distinct nicknames read from the file.
+    std::size_t nicknames{0};
+
+    // Memory taken to hold the nicknames.
+    std::size_t bytes{0};
+
+    // Temporary memory taken at most while reading the file and building the
+    // memory holding the nicknames.
+    std::size_t peak_bytes{0};
+
+    // Time spent reading the file and building its filter.
+    std::chrono::nanoseconds duration{0};
+};
+
+// Small state random number engine used by default by the nickname generator,
+// xoshiro256++ by David Blackman and Sebastiano Vigna. Follows the interface of
+// the standard engines so it can be used with the standard distributions.
+class xoshiro256pp
+{
+  public:
+    // Type of the generated numbers.
+    using result_type = std::uint64_t;
+
+    // Seeds the engine with the default seed.
+    xoshiro256pp()
+    {
+        seed(default_seed);
+    }
+
+    // Seeds the engine from a single value.
+    explicit xoshiro256pp(result_type value)
+    {
+        seed(value);
+    }
+
+    // Seeds the engine from a seed sequence.
+    explicit xoshiro256pp(std::seed_seq& sequence)
+    {
+        seed(sequence);
+    }
+
+    // Default seed, matching the standard engines.
+    static constexpr result_type default_seed{5489u};
+
+    // Smallest generated number.
+    static constexpr result_type min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    // Biggest generated number.
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    // Expands the value into the whole state through splitmix64.
+    void seed(result_type value)
+    {
+        for (auto& word : _state)
+        {
+            value += 0x9E3779B97F4A7C15;
+
+            // Mixed copy of the value, becoming the next state word.
+            result_type mixed{value};
+
+            mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9;
+            mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EB;
+            word = mixed ^ (mixed >> 31);
+        }
+    }
+
+    // Fills the whole state from the seed sequence.
+    void seed(std::seed_seq& sequence)
+    {
+        // Two 32 bits halves for each state word.
+        std::array<std::uint32_t, 8> halves{};
+
+        sequence.generate(halves.begin(), halves.end());
+
+        for (std::size_t i{0}; i < _state.size(); i++)
+        {
+            _state[i] = (static_cast<result_type>(halves[2 * i]) << 32) |
+                        halves[(2 * i) + 1];
+        }
+
+        // An all zeroes state would only ever generate zeroes.
+        if ((_state[0] | _state[1] | _state[2] | _state[3]) == 0)
+        {
+            seed(default_seed);
+        }
+    }
+
+    // Generates the next number.
+    result_type operator()()
+    {
+        const result_type result{rotl(_state[0] + _state[3], 23) + _state[0]};
+
+        // Shifted second word, mixed into the third.
+        const result_type shifted{_state[1] << 17};
+
+        _state[2] ^= _state[0];
+        _state[3] ^= _state[1];
+        _state[1] ^= _state[2];
+        _state[0] ^= _state[3];
+        _state[2] ^= shifted;
+        _state[3] = rotl(_state[3], 45);
+
+        return result;
+    }
+
+    // Advances the engine by the requested amount of numbers.
+    void discard(unsigned long long amount)
+    {
+        for (; amount > 0; amount--)
+        {
+            (*this)();
+        }
+    }
+
+    // Engines in the same state generate the same numbers.
+    friend bool operator==(const xoshiro256pp&, const xoshiro256pp&) = default;
+
+  private:
+    // Rotates the bits of the value to the left.
+    static constexpr result_type rotl(result_type value, int bits)
+    {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    // Current engine state.
+    std::array<result_type, 4> _state{};
+};
+
+// The nickname generator generates as realistic as possible gamers nicknames
+// akin to professional players, allowing requests specifying the player name.
+// Each generator owns its wordlists and draws every random decision from its
+// own instance of the Engine in each thread using it.
+template <typename Engine> class basic_nng
+{
+  public:
+    // Creates a generator loading the default resources folder, with a random
+    // seed.
+    basic_nng() : basic_nng(_default_resources_path)
+    {
+    }
+
+    // Creates a generator loading the received resource path. Generators
+    // receiving the same seed generate the same nicknames on each thread,
+    // provided threads start using them in the same order.
+    explicit basic_nng(const std::filesystem::path& resource_path,
+                       std::optional<std::uint64_t> seed = std::nullopt)
+        : _seed(seed.value_or(random_seed()))
+    {
+        load(resource_path);
+    }
+
+    // Releases the wordlists snapshots still kept by the states of threads
+    // that used the generator, so mapped files and corpora don't outlive it.
+    ~basic_nng()
+    {
+        const std::lock_guard lock{_thread_states_guard};
+
+        for (const auto& registered : _thread_states)
+        {
+            // State kept alive while its snapshot is released.
+            if (const auto existing{registered.lock()})
+            {
+                existing->wordlists.reset();
+            }
+        }
+    }
+
+    // Copy/move constructors can be deleted since each generator identifies
+    // its own random streams.
+    basic_nng(const basic_nng&) = delete;
+    basic_nng(basic_nng&&) = delete;
+    basic_nng& operator=(const basic_nng&) = delete;
+    basic_nng& operator=(basic_nng&&) = delete;
+
+    // Thread safe access to the nickname generator shared by the whole
+    // process, for convenience.
+    static basic_nng& instance()
+    {
+        static basic_nng instance;
+        return instance;
+    }
+
+    // Generates a nickname based on requested name(optional). The name is
+    // split without being prepared, only the drawn strategy result is
+    // computed.
+    [[nodiscard]] nickname get_nickname(std::wstring_view name = {}) const
+    {
+        // Generated nickname.
+        nickname generated;
+
+        generate(name, generated);
+
+        return generated;
+    };
+
+    // Generates a nickname based on an already prepared name.
+    [[nodiscard]] nickname get_nickname(const prepared_name& name) const
+    {
+        // Generated nickname.
+        nickname generated;
+
+        generate(name, generated);
+
+        return generated;
+    };
+
+    // Generates a nickname based on an already prepared name into the
+    // received nickname, reusing its memory.
+    void get_nickname(nickname& output, const prepared_name& name) const
+    {
+        generate(name, output);
+    };
+
+    // Generates a nickname based on the name, allocating the nickname from
+    // the memory resource.
+    [[nodiscard]] nickname get_nickname(
+        std::wstring_view name, std::pmr::memory_resource* resource) const
+    {
+        // Generated nickname.
+        nickname generated{nickname::allocator_type{resource}};
+
+        generate(name, generated);
+
+        return generated;
+    };
+
+    // Generates a nickname based on an already prepared name, allocating the
+    // nickname from the memory resource.
+    [[nodiscard]] nickname get_nickname(
+        const prepared_name& name, std::pmr::memory_resource* resource) const
+    {
+        // Generated nickname.
+        nickname generated{nickname::allocator_type{resource}};
+
+        generate(name, generated);
+
+        return generated;
+    };
+
+    // Generates the requested amount of nicknames based on requested
+    // name(optional), replacing the received container contents. Nicknames
+    // already in the container have their memory reused, so passing the same
+    // container on subsequent batches avoids allocations altogether. New
+    // nicknames in a container using a memory resource take their memory
+    // from it.
+    template <typename Allocator>
+    void get_nicknames(std::vector<nickname, Allocator>& nicknames,
+                       std::size_t count, std::wstring_view name = {}) const
+    {
+        get_nicknames(nicknames, count,
+                      prepare(name, resource_of(nicknames.get_allocator())));
+    }
+
+    // Generates the requested amount of nicknames based on an already
+    // prepared name, replacing the received container contents.
+    template <typename Allocator>
+    void get_nicknames(std::vector<nickname, Allocator>& nicknames,
+                       std::size_t count, const prepared_name& name) const
+    {
+        nicknames.resize(count);
+
+        for (auto& generated : nicknames)
+        {
+            generate(name, generated);
+        }
+    }
+
+    // Generates the requested amount of nicknames based on requested
+    // name(optional).
+    [[nodiscard]] std::vector<nickname> get_nicknames(
+        std::size_t count, std::wstring_view name = {}) const
+    {
+        // Generated nicknames.
+        std::vector<nickname> nicknames;
+
+        get_nicknames(nicknames, count, name);
+
+        return nicknames;
+    }
+
+    // Generates the requested amount of nicknames based on an already
+    // prepared name.
+    [[nodiscard]] std::vector<nickname> get_nicknames(
+        std::size_t count, const prepared_name& name) const
+    {
+        // Generated nicknames.
+        std::vector<nickname> nicknames;
+
+        get_nicknames(nicknames, count, name);
+
+        return nicknames;
+    }
+
+    // Try loading every possible wordlists file from the received resource
+    // path, which may also point directly to a compiled wordlists file. The
+    // wordlists are added to the ones already loaded. Safe to call while
+    // other threads generate nicknames, which keep using the previous
+    // wordlists until the load is complete. Each loaded wordlist is drawn
+    // according to the received weight, relative to the other wordlists.
+    // Returns the time taken by each file read, throws without changing the
+    // wordlists if any file holds a malformed word weight.
+    std::vector<file_load> load(const std::filesystem::path& resource_path,
+                                std::uint32_t weight = 1)
+    {
+        if (weight == 0)
+        {
+            throw(std::invalid_argument("Wordlist weight can't be zero"));
+        }
+
+        // Time taken by each file read.
+        std::vector<file_load> report;
+
+        // Wordlists read before blocking any other change.
+        std::vector<wordlist> loaded{read_resources(resource_path, report)};
+
+        const std::lock_guard lock{_writer};
+
+        // Current wordlists being extended by the loaded ones.
+        const std::shared_ptr<const wordlists_snapshot> current{snapshot()};
+
+        // Copy of the current wordlists, extended by the loaded ones.
+        std::vector<wordlist> extended{current->lists};
+
+        // Weight of each wordlist, extended by the loaded ones.
+        std::vector<std::uint32_t> weights{current->weights};
+
+        extended.insert(extended.end(), std::make_move_iterator(loaded.begin()),
+                        std::make_move_iterator(loaded.end()));
+        weights.resize(extended.size(), weight);
+
+        publish(std::make_shared<const wordlists_snapshot>(
+            std::move(extended), std::move(weights), current->reserved));
+
+        return report;
+    }
+
+    // Replaces every loaded wordlist by the ones read from the received
+    // resource path, as a single change. Each wordlist is drawn according to
+    // the received weight. Returns the time taken by each file read, throws
+    // without changing the wordlists if any file holds a malformed weight.
+    std::vector<file_load> reload(const std::filesystem::path& resource_path,
+                                  std::uint32_t weight = 1)
+    {
+        if (weight == 0)
+        {
+            throw(std::invalid_argument("Wordlist weight can't be zero"));
+        }
+
+        // Time taken by each file read.
+        std::vector<file_load> report;
+
+        // Wordlists read before blocking any other change.
+        std::vector<wordlist> loaded{read_resources(resource_path, report)};
+
+        // Weight of each wordlist.
+        std::vector<std::uint32_t> weights(loaded.size(), weight);
+
+        const std::lock_guard lock{_writer};
+
+        publish(std::make_shared<const wordlists_snapshot>(
+            std::move(loaded), std::move(weights), snapshot()->reserved));
+
+        return report;
+    }
+
+    // Removes every loaded wordlist, nicknames stay reserved.
+    void unload()
+    {
+        const std::lock_guard lock{_writer};
+
+        publish(std::make_shared<const wordlists_snapshot>(
+            std::vector<wordlist>{}, std::vector<std::uint32_t>{},
+            snapshot()->reserved));
+    }
+
+    // Reads the UTF-8 file holding a taken nickname per line, which are never
+    // generated afterwards. Each nickname is kept as a fingerprint of about
+    // 2.5 bytes, one in 65536 nicknames not taken is skipped as well. Lines
+    // are taken as a whole, tabs included. Throws if the file can't be read.
+    // Returns the amount of nicknames read, the memory holding them, the
+    // temporary memory taken at most and the time taken.
+    reserved_load reserve(const std::filesystem::path& file)
+    {
+        // Moment the file started being read.
+        const auto start{std::chrono::steady_clock::now()};
+
+        std::ifstream input{file, std::ios::binary};
+
+        if (!input)
+        {
+            throw(std::runtime_error("Unable to open reserved nicknames"));
+        }
+
+        // Bytes read from the file at a time.
+        std::string chunk(_reserve_chunk_size, '\0');
+
+        // Start of a line continued by the next chunk.
+        std::string partial;
+
+        // Line being hashed, decoded into the same memory every time.
+        std::wstring decoded;
+
+        // Hash of every nickname.
+        std::vector<std::uint64_t> hashes;
+
+        // Whether the first line, which may start with a byte order mark,
+        // is yet to be hashed.
+        bool first_line{true};
+
+        // Hashes the line, unless it is blank.
+        const auto add_line{[&](std::string_view line) {
+            if (std::exchange(first_line, false) &&
+                line.starts_with("\xEF\xBB\xBF"))
+            {
+                line.remove_prefix(3);
+            }
+
+            if (line.ends_with('\r'))
+            {
+                line.remove_suffix(1);
+            }
+
+            if (!line.empty())
+            {
+                decoded.clear();
+                utf8::decode(decoded, line);
+                hashes.push_back(hash(decoded));
+            }
+        }};
+
+        while (input)
+        {
+            input.read(chunk.data(),
+                       static_cast<std::streamsize>(chunk.size()));
+
+            // Bytes of the chunk not split into lines yet.
+            std::string_view rest{chunk.data(),
+                                  static_cast<std::size_t>(input.gcount())};
+
+            for (auto end{rest.find('\n')}; end != std::string_view::npos;
+                 end = rest.find('\n'))
+            {
+                if (partial.empty())
+                {
+                    add_line(rest.substr(0, end));
+                }
+                else
+                {
+                    partial.append(rest.substr(0, end));
+                    add_line(partial);
+                    partial.clear();
+                }
+
+                rest.remove_prefix(end + 1);
+            }
+
+            partial.append(rest);
+        }
+
+        if (input.bad())
+        {
+            throw(std::runtime_error("Unable to read reserved nicknames"));
+        }
+
+        // The last line may not end with a line break.
+        add_line(partial);
+
+        // Temporary memory taken reading the file.
+        const std::size_t read_bytes{
+            chunk.capacity() + partial.capacity() +
+            (decoded.capacity() * sizeof(wchar_t)) +
+            (hashes.capacity() * sizeof(std::uint64_t))};
+
+        // Filter matching every nickname.
+        auto filter{std::make_shared<const xor_filter>(std::move(hashes))};
+
+        // Amount of distinct nicknames and memory taken by them.
+        const std::size_t nicknames{filter->size()};
+        const std::size_t bytes{filter->bytes()};
+        const std::size_t peak_bytes{
+            std::max(read_bytes, filter->build_bytes())};
+
+        const std::lock_guard lock{_writer};
+
+        // Current snapshot being extended by the filter.
+        const std::shared_ptr<const wordlists_snapshot> current{snapshot()};
+
+        // Filters of every reserved nickname, extended by the new one.
+        std::vector<std::shared_ptr<const xor_filter>> reserved{
+            current->reserved};
+
+        reserved.push_back(std::move(filter));
+
+        publish(std::make_shared<const wordlists_snapshot>(
+            current->lists, current->weights, std::move(reserved)));
+
+        return {file, nicknames, bytes, peak_bytes,
+                std::chrono::steady_clock::now() - start};
+    }
+
+    // Forgets every reserved nickname.
+    void unreserve()
+    {
+        const std::lock_guard lock{_writer};
+
+        // Current snapshot, kept without reserved nicknames.
+        const std::shared_ptr<const wordlists_snapshot> current{snapshot()};
+
+        publish(std::make_shared<const wordlists_snapshot>(
+            current->lists, current->weights,
+            std::vector<std::shared_ptr<const xor_filter>>{}));
+    }
+
+    // Enables or disables the uniqueness mode. While enabled, every nickname
+    // generated is different from any other generated while enabled, since
+    // the generator was created. Nicknames issued before are discarded and
+    // generated again, up to a limit after which generating throws.
+    void unique(bool enabled)
+    {
+        _unique.store(enabled, std::memory_order_relaxed);
+    }
+
+    // Amount of nicknames issued by the uniqueness mode and of nicknames
+    // discarded for having been issued before or being reserved.
+    [[nodiscard]] uniqueness_stats unique_stats() const
+    {
+        return {_unique_issued.load(std::memory_order_relaxed),
+                _unique_retries.load(std::memory_order_relaxed)};
+    }
+
+    // Statistics of every nickname generated so far by every thread, empty
+    // unless DASMIG_NNG_STATS is defined. Each thread records its own, taking
+    // the statistics doesn't stop any thread generating nicknames.
+    [[nodiscard]] generation_stats stats() const
+    {
+        // Statistics summed over every thread.
+        generation_stats summed;
+
+#ifdef DASMIG_NNG_STATS
+        const std::lock_guard lock{_stats_guard};
+
+        for (std::size_t i{0}; i < _counter_names.size(); i++)
+        {
+            // Amount of times counted by every thread.
+            std::uint64_t total{_retired_stats.counters[i]};
+
+            for (const auto& live : _live_stats)
+            {
+                total += live->counters[i].load(std::memory_order_relaxed);
+            }
+
+            summed.counters.emplace_back(_counter_names[i], total);
+        }
+
+        for (std::size_t i{0}; i < _latency_names.size(); i++)
+        {
+            // Times recorded by every thread.
+            latency_histogram total;
+
+            for (std::size_t j{0}; j < latency_histogram::bucket_count; j++)
+            {
+                // Amount of times in the bucket of every thread.
+                std::uint64_t times{_retired_stats.latencies[i][j]};
+
+                for (const auto& live : _live_stats)
+                {
+                    times += live->latencies[i][j].load(
+                        std::memory_order_relaxed);
+                }
+
+                total.add(j, times);
+            }
+
+            summed.latencies.emplace_back(_latency_names[i], total);
+        }
+#endif
+
+        return summed;
+    }
+
+    // Compiles every wordlists file from the received resource path into a
+    // single file that can later be loaded without any parsing. An existing
+    // output file is replaced as a whole, never rewritten in place, so
+    // generators that loaded it keep working.
+    static void compile(const std::filesystem::path& resource_path,
+                        const std::filesystem::path& output_file)
+    {
+        // Time taken by each file read, not reported when compiling.
+        std::vector<file_load> report;
+
+        write_compiled(read_resources(resource_path, report), output_file);
+    }
+
+  private:
+    // Random bits drawn from the engine 64 at a time, every decision carving
+    // only the bits it needs from them.
+    class random_bits
+    {
+      public:
+        // Seeds the engine the bits are drawn from.
+        explicit random_bits(std::seed_seq& sequence) : _engine(sequence)
+        {
+        }
+
+        // Takes the requested amount of random bits, between 1 and 64.
+        std::uint64_t take(std::size_t count)
+        {
+            if (count <= _available)
+            {
+                // Lowest bits of the buffer, taken by this request.
+                const std::uint64_t value{_bits & mask(count)};
+
+                _bits = (count == 64) ? 0 : (_bits >> count);
+                _available -= count;
+
+                return value;
+            }
+
+            // Fresh bits completing the ones left in the buffer.
+            const std::uint64_t fresh{
+                std::uniform_int_distribution<std::uint64_t>{}(_engine)};
+
+            // Amount of fresh bits taken by this request.
+            const std::size_t missing{count - _available};
+
+            // Left over bits on the lowest positions, fresh ones above them.
+            const std::uint64_t value{(_bits | (fresh << _available)) &
+                                      mask(count)};
+
+            _bits = (missing == 64) ? 0 : (fresh >> missing);
+            _available = 64 - missing;
+
+            return value;
+        }
+
+        // Whether a single random bit is set, 1/2 chance.
+        bool coin()
+        {
+            return take(1) != 0;
+        }
+
+        // Draws true with the requested probability, with 1/2^16 precision.
+        bool chance(double probability)
+        {
+            return static_cast<double>(take(16)) < probability * 65536.0;
+        }
+
+        // Draws an unbiased value in [0, bound), bound must be lower than
+        // 2^32. Uses Lemire's multiply and shift on just enough bits for the
+        // bound, rejecting the few values that would make some results more
+        // likely, at most 1/256 of them.
+        std::size_t below(std::uint64_t bound)
+        {
+            // Amount of random bits scaled into the bound.
+            const std::size_t precision{std::min<std::size_t>(
+                std::bit_width(bound) + 8, 32)};
+
+            // Random value scaled into the bound, the result is on the top.
+            std::uint64_t scaled{take(precision) * bound};
+
+            if ((scaled & mask(precision)) < bound)
+            {
+                // Values below this threshold are rejected.
+                const std::uint64_t threshold{(mask(precision) + 1) % bound};
+
+                while ((scaled & mask(precision)) < threshold)
+                {
+                    scaled = take(precision) * bound;
+                }
+            }
+
+            return static_cast<std::size_t>(scaled >> precision);
+        }
+
+      private:
+        // Mask selecting the lowest requested amount of bits.
+        static constexpr std::uint64_t mask(std::size_t count)
+        {
+            return (count == 64) ? ~std::uint64_t{0}
+                                 : ((std::uint64_t{1} << count) - 1);
+        }
+
+        // Engine the random bits are drawn from.
+        Engine _engine;
+
+        // Random bits not taken yet, lowest first.
+        std::uint64_t _bits{0};
+
+        // Amount of random bits not taken yet.
+        std::size_t _available{0};
+    };
+
+    // Immutable wordlists and reserved nicknames shared by the threads
+    // generating nicknames.
+    struct wordlists_snapshot
+    {
+        // Empty snapshot.
+        wordlists_snapshot() = default;
+
+        // Takes the wordlists, the weight of each one and the filters of
+        // reserved nicknames.
+        wordlists_snapshot(
+            std::vector<wordlist> wordlists,
+            std::vector<std::uint32_t> wordlist_weights,
+            std::vector<std::shared_ptr<const xor_filter>> reserved_filters)
+            : lists(std::move(wordlists)), weights(std::move(wordlist_weights)),
+              index(weights), reserved(std::move(reserved_filters))
+        {
+        }
+
+        // Every loaded wordlist.
+        std::vector<wordlist> lists;
+
+        // Weight of each wordlist.
+        std::vector<std::uint32_t> weights;
+
+        // Table drawing each wordlist according to its weight.
+        weighted_index index;
+
+        // Filters matching the reserved nicknames, one per file read.
+        std::vector<std::shared_ptr<const xor_filter>> reserved;
+    };
+
+    // Names of the counters recorded by each thread, in order.
+    static constexpr std::array<std::string_view, 41> _counter_names{
+        "solver.first_name",
+        "solver.last_name",
+        "solver.any_name",
+        "solver.initials",
+        "solver.mix_two",
+        "solver.initial_plus_last",
+        "solver.first_plus_initial",
+        "solver.reduce_single_name",
+        "solver.wordlist",
+        "leetify.skipped",
+        "leetify.finalizer.reverse",
+        "leetify.finalizer.duovowel",
+        "leetify.finalizer.oneleet",
+        "leetify.finalizer.allleet",
+        "leetify.xfy",
+        "leetify.reverse",
+        "leetify.yfy",
+        "leetify.numify",
+        "leetify.tracefy",
+        "leetify.ingify",
+        "leetify.forced",
+        "leetify.exhausted",
+        "leetify.depth.0",
+        "leetify.depth.1",
+        "leetify.depth.2",
+        "leetify.depth.3",
+        "leetify.depth.4",
+        "leetify.depth.5",
+        "leetify.depth.6",
+        "leetify.depth.7+",
+        "format.snake_case",
+        "format.upper_case",
+        "format.lower_case",
+        "format.title_case",
+        "format.sentence_case",
+        "format.camel_case",
+        "format.reverse_sentence_case",
+        "format.bathtub_case",
+        "format.winding_case",
+        "format.random_case",
+        "format.random_single_case"};
+
+    // Position of the first counter of each group, followed by the position
+    // of each single counter.
+    static constexpr std::size_t _strategy_counters{0};
+    static constexpr std::size_t _wordlist_counter{8};
+    static constexpr std::size_t _skipped_counter{9};
+    static constexpr std::size_t _finalizer_counters{10};
+    static constexpr std::size_t _leetifier_counters{14};
+    static constexpr std::size_t _forced_counter{20};
+    static constexpr std::size_t _exhausted_counter{21};
+    static constexpr std::size_t _depth_counters{22};
+    static constexpr std::size_t _snake_case_counter{30};
+    static constexpr std::size_t _format_counters{31};
+
+    // Deepest leetify retries counted on their own, deeper ones counted with
+    // them.
+    static constexpr std::size_t _max_counted_depth{7};
+
+    // Amount of letters oneleet stores as candidates, longer nicknames are
+    // searched again for the drawn letter.
+    static constexpr std::size_t _max_leet_candidates{32};
+
+    // Amount of names/surnames a name generating a single nickname can be
+    // split into without preparing it.
+    static constexpr std::size_t _max_split_parts{32};
+
+    // Amount of leetify rounds after which a nickname is left as it is, even
+    // if still equal to its original word.
+    static constexpr std::size_t _max_leetify_rounds{8};
+
+    // Each thread times the stages of one nickname out of this many.
+    static constexpr std::size_t _timed_nicknames{64};
+
+    // Names of the stages whose time is recorded by each thread, in order.
+    static constexpr std::array<std::string_view, 4> _latency_names{
+        "generate", "solver.select", "leetify", "format"};
+
+    // Position of each stage whose time is recorded.
+    static constexpr std::size_t _generate_latency{0};
+    static constexpr std::size_t _select_latency{1};
+    static constexpr std::size_t _leetify_latency{2};
+    static constexpr std::size_t _format_latency{3};
+
+    // Statistics recorded by a single thread, written by that thread only
+    // and read by any thread taking the statistics.
+    struct thread_stats
+    {
+        // Amount of times each counter was counted.
+        std::array<std::atomic<std::uint64_t>, _counter_names.size()>
+            counters{};
+
+        // Amount of times recorded in each bucket of each stage.
+        std::array<std::array<std::atomic<std::uint64_t>,
+                              latency_histogram::bucket_count>,
+                   _latency_names.size()>
+            latencies{};
+
+        // Amount of nicknames left before the next one has its stages timed.
+        std::size_t until_timed{0};
+
+        // Whether the stages of the current nickname are timed.
+        bool timed{false};
+    };
+
+    // Statistics of the threads no longer generating nicknames.
+    struct retired_stats
+    {
+        // Amount of times each counter was counted.
+        std::array<std::uint64_t, _counter_names.size()> counters{};
+
+        // Amount of times recorded in each bucket of each stage.
+        std::array<std::array<std::uint64_t, latency_histogram::bucket_count>,
+                   _latency_names.size()>
+            latencies{};
+    };
+
+    // Counts the event in the statistics of the calling thread.
+    void count([[maybe_unused]] std::size_t counter) const
+    {
+#ifdef DASMIG_NNG_STATS
+        // Counter only ever written by the calling thread.
+        std::atomic<std::uint64_t>& value{state().stats->counters[counter]};
+
+        value.store(value.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+#endif
+    }
+
+    // Decides whether the stages of the nickname about to be generated are
+    // timed, reading the clock costs about as much as generating a nickname
+    // so only one nickname out of every _timed_nicknames is timed.
+    void time_next_nickname() const
+    {
+#ifdef DASMIG_NNG_STATS
+        // Statistics of the calling thread.
+        thread_stats& current{*state().stats};
+
+        current.timed = (current.until_timed == 0);
+        current.until_timed = (current.until_timed == 0)
+                                  ? _timed_nicknames - 1
+                                  : current.until_timed - 1;
+#endif
+    }
+
+    // Moment a stage starts, only read when the nickname stages are timed.
+    std::chrono::steady_clock::time_point stage_start() const
+    {
+#ifdef DASMIG_NNG_STATS
+        if (state().stats->timed)
+        {
+            return std::chrono::steady_clock::now();
+        }
+#endif
+        return {};
+    }
+
+    // Records the time taken by the stage since it started when the nickname
+    // stages are timed, returning the moment it ended so the next stage can
+    // start from it.
+    std::chrono::steady_clock::time_point stage_end(
+        [[maybe_unused]] std::size_t latency,
+        std::chrono::steady_clock::time_point start) const
+    {
+#ifdef DASMIG_NNG_STATS
+        if (!state().stats->timed)
+        {
+            return start;
+        }
+
+        // Moment the stage ended.
+        const auto end{std::chrono::steady_clock::now()};
+
+        // Bucket only ever written by the calling thread.
+        std::atomic<std::uint64_t>& value{
+            state().stats->latencies[latency][latency_histogram::bucket(
+                static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        end - start)
+                        .count()))]};
+
+        value.store(value.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+
+        return end;
+#else
+        return start;
+#endif
+    }
+
+    // Amount of times the counter was counted by the calling thread.
+    [[nodiscard]] std::uint64_t counted(
+        [[maybe_unused]] std::size_t counter) const
+    {
+#ifdef DASMIG_NNG_STATS
+        return state().stats->counters[counter].load(
+            std::memory_order_relaxed);
+#else
+        return 0;
+#endif
+    }
+
+#ifdef DASMIG_NNG_STATS
+    // Moves the statistics of the threads no longer using the generator
+    // into the retired ones, must be called holding the statistics guard.
+    void retire_stats() const
+    {
+        std::erase_if(_live_stats, [this](const auto& live) {
+            if (live.use_count() > 1)
+            {
+                return false;
+            }
+
+            // Every write of the thread happened before its state released
+            // the statistics.
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            for (std::size_t i{0}; i < _counter_names.size(); i++)
+            {
+                _retired_stats.counters[i] +=
+                    live->counters[i].load(std::memory_order_relaxed);
+            }
+
+            for (std::size_t i{0}; i < _latency_names.size(); i++)
+            {
+                for (std::size_t j{0}; j < latency_histogram::bucket_count;
+                     j++)
+                {
+                    _retired_stats.latencies[i][j] +=
+                        live->latencies[i][j].load(std::memory_order_relaxed);
+                }
+            }
+
+            return true;
+        });
+    }
+#endif
+
+    // State of a single generator in a single thread.
+    struct thread_state
+    {
+        // Identifier of the generator owning the state.
+        std::uint64_t owner;
+
+        // Random bits drawn by the generator in the thread.
+        random_bits bits;
+
+        // Wordlists snapshot last seen by the thread, kept alive until the
+        // thread generates a nickname after a newer one is published.
+        std::shared_ptr<const wordlists_snapshot> wordlists;
+
+        // Version of the wordlists snapshot.
+        std::uint64_t version;
+
+#ifdef DASMIG_NNG_STATS
+        // Statistics recorded by the thread, also seen by the generator.
+        std::shared_ptr<thread_stats> stats;
+#endif
+    };
+
+    // State of this generator in the calling thread. Each thread keeps the
+    // states of the last few generators it used, the oldest state making room
+    // for a generator without one.
+    thread_state& state() const
+    {
+        // States of the generators used by the thread.
+        thread_local std::vector<std::shared_ptr<thread_state>> states;
+
+        // State used last by the thread, usually the one requested again.
+        thread_local thread_state* last{nullptr};
+
+        // Position of the next state making room for a new one.
+        thread_local std::size_t oldest{0};
+
+        if ((last != nullptr) && (last->owner == _id))
+        {
+            return *last;
+        }
+
+        for (const auto& existing : states)
+        {
+            if (existing->owner == _id)
+            {
+                last = existing.get();
+                return *last;
+            }
+        }
+
+        // Position of the new random stream among every stream of the
+        // generator.
+        const std::uint64_t ordinal{
+            _streams.fetch_add(1, std::memory_order_relaxed)};
+
+        // Each stream is seeded from the generator seed and its position.
+        std::seed_seq sequence{static_cast<std::uint32_t>(_seed),
+                               static_cast<std::uint32_t>(_seed >> 32),
+                               static_cast<std::uint32_t>(ordinal),
+                               static_cast<std::uint32_t>(ordinal >> 32)};
+
+        // Version of the snapshot, read before the snapshot itself so a
+        // newer snapshot is at worst reloaded needlessly.
+        const std::uint64_t version{_version.load(std::memory_order_acquire)};
+
+        // State created for this generator.
+        auto created{std::make_shared<thread_state>(
+            _id, random_bits{sequence}, snapshot(), version)};
+
+        {
+            const std::lock_guard lock{_thread_states_guard};
+
+            // States released by their threads since the last registration.
+            std::erase_if(_thread_states, [](const auto& registered) {
+                return registered.expired();
+            });
+            _thread_states.push_back(created);
+        }
+
+#ifdef DASMIG_NNG_STATS
+        created->stats = std::make_shared<thread_stats>();
+
+        {
+            const std::lock_guard lock{_stats_guard};
+
+            retire_stats();
+            _live_stats.push_back(created->stats);
+        }
+#endif
+
+        last = created.get();
+
+        if (states.size() < _max_thread_states)
+        {
+            states.push_back(std::move(created));
+        }
+        else
+        {
+            states[oldest] = std::move(created);
+            oldest = (oldest + 1) % _max_thread_states;
+        }
+
+        return *last;
+    }
+
+    // Random bits of this generator in the calling thread.
+    random_bits& bits() const
+    {
+        return state().bits;
+    }
+
+    // Draws a position lower than size according to the table, uniformly
+    // when the table is empty.
+    std::size_t draw(const weighted_index& weights, std::size_t size) const
+    {
+        // Uniformly drawn column of the table.
+        const std::size_t column{bits().below(size)};
+
+        if (weights.empty())
+        {
+            return column;
+        }
+
+        return weights.pick(column,
+                            static_cast<std::uint32_t>(bits().take(32)));
+    }
+
+    // Latest wordlists snapshot seen by the calling thread, only touching the
+    // shared snapshot when a newer one was published.
+    const wordlists_snapshot& wordlists() const
+    {
+        // State holding the snapshot seen by the thread.
+        thread_state& current{state()};
+
+        // Version of the latest snapshot.
+        const std::uint64_t version{_version.load(std::memory_order_acquire)};
+
+        if (current.version != version)
+        {
+            current.wordlists = snapshot();
+            current.version = version;
+        }
+
+        return *current.wordlists;
+    }
+
+    // Shared ownership of the latest wordlists snapshot.
+    std::shared_ptr<const wordlists_snapshot> snapshot() const
+    {
+        const std::lock_guard lock{_snapshot_guard};
+
+        return _wordlists;
+    }
+
+    // Makes the snapshot visible to every thread generating nicknames. The
+    // previous snapshot is released once no thread sees it anymore.
+    void publish(std::shared_ptr<const wordlists_snapshot> replacement)
+    {
+        {
+            const std::lock_guard lock{_snapshot_guard};
+
+            _wordlists.swap(replacement);
+        }
+
+        _version.fetch_add(1, std::memory_order_release);
+    }
+
+    // Seed of a generator created without one.
+    static std::uint64_t random_seed()
+    {
+        // Source of nondeterministic random numbers.
+        std::random_device device;
+
+        return ((static_cast<std::uint64_t>(device()) << 32) | device()) ^
+               static_cast<std::uint64_t>(
+                   std::chrono::steady_clock::now().time_since_epoch().count());
+    }
+
+    // Methods used to generate a nickname from the player name.
+    enum class name_strategy
+    {
+        first_name,
+        last_name,
+        any_name,
+        initials,
+        mix_two,
+        initial_plus_last,
+        first_plus_initial,
+        reduce_single_name
+    };
+
+    // Name a nickname is generated from, either prepared beforehand or split
+    // on the fly for a single nickname.
+    struct name_view
+    {
+        // Full name, including spaces.
+        std::wstring_view full;
+
+        // Each name/surname composing the full name.
+        std::span<const std::wstring_view> parts;
+
+        // Cached strategy results of a prepared name, null when each drawn
+        // strategy result is computed on the fly instead.
+        const prepared_name::parsed* cached{nullptr};
+
+        // Whether there's no name to generate nicknames from.
+        [[nodiscard]] bool empty() const
+        {
+            return parts.empty();
+        }
+    };
+
+    // Methods used to finalize the leetifying of a nickname.
+    enum class finalizer
+    {
+        reverse,
+        duovowel,
+        oneleet,
+        allleet
+    };
+
+    // Methods used to leetify a nickname.
+    enum class leetifier
+    {
+        xfy,
+        reverse,
+        yfy,
+        numify,
+        tracefy,
+        ingify
+    };
+
+    // Methods used to format the nickname case.
+    enum class case_format
+    {
+        upper_case,
+        lower_case,
+        title_case,
+        sentence_case,
+        camel_case,
+        reverse_sentence_case,
+        bathtub_case,
+        winding_case,
+        random_case,
+        random_single_case
+    };
+
+    // Walker alias table built at compile time, draws one of N options
+    // according to their integer weights in constant time.
+    template <std::size_t N> class alias_table
+    {
+      public:
+        // Builds the table from the weight of each option.
+        constexpr explicit alias_table(
+            const std::array<std::uint32_t, N>& weights)
+        {
+            for (const auto& weight : weights)
+            {
+                _total += weight;
+            }
+
+            // Weight of each option scaled so that each column of the table
+            // holds exactly the total weight.
+            std::array<std::uint64_t, N> scaled{};
+
+            // Options whose scaled weight doesn't fill their own column.
+            std::array<std::size_t, N> small{};
+            std::size_t small_count{0};
+
+            // Options whose scaled weight overflows their own column.
+            std::array<std::size_t, N> large{};
+            std::size_t large_count{0};
+
+            for (std::size_t i{0}; i < N; i++)
+            {
+                scaled[i] = std::uint64_t{weights[i]} * N;
+
+                if (scaled[i] < _total)
+                {
+                    small[small_count++] = i;
+                }
+                else
+                {
+                    large[large_count++] = i;
+                }
+            }
+
+            // Fill the remainder of each small column with a large option.
+            while ((small_count > 0) && (large_count > 0))
+            {
+                const std::size_t lesser{small[--small_count]};
+                const std::size_t greater{large[large_count - 1]};
+
+                _thresholds[lesser] = scaled[lesser];
+                _aliases[lesser] = greater;
+                scaled[greater] -= _total - scaled[lesser];
+
+                if (scaled[greater] < _total)
+                {
+                    large_count--;
+                    small[small_count++] = greater;
+                }
+            }
+
+            // Remaining options fill their whole column.
+            for (std::size_t i{0}; i < large_count; i++)
+            {
+                _thresholds[large[i]] = _total;
+                _aliases[large[i]] = large[i];
+            }
+        }
+
+        // Draws the position of an option, a single random value selects
+        // both the column and the threshold within it.
+        [[nodiscard]] std::size_t draw(random_bits& bits) const
+        {
+            // Random column and threshold packed together.
+            const std::uint64_t value{bits.below(N * _total)};
+
+            // Column of the table being drawn.
+            const std::size_t column{value / _total};
+
+            return ((value % _total) < _thresholds[column]) ? column
+                                                            : _aliases[column];
+        }
+
+      private:
+        // Sum of every option weight.
+        std::uint64_t _total{0};
+
+        // Part of each column that belongs to its own option.
+        std::array<std::uint64_t, N> _thresholds{};
+
+        // Option owning the rest of each column.
+        std::array<std::size_t, N> _aliases{};
+    };
+
+    // Header found at the beginning of compiled wordlists files.
+    struct compiled_header
+    {
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        std::uint32_t byte_order;
+        std::uint64_t list_count;
+    };
+
+    // Describes a single wordlist of a compiled wordlists file, positions are
+    // in bytes counted from the beginning of the file.
+    struct compiled_list
+    {
+        std::uint64_t word_count;
+        std::uint64_t offsets_position;
+        std::uint64_t characters_position;
+        std::uint64_t characters_count;
+
+        // Threshold and alias of each column of the weighted words table,
+        // zero when every word is equally likely.
+        std::uint64_t weights_position;
+    };
+
+    // Extension of compiled wordlists files.
+    static const inline std::filesystem::path _compiled_extension{".cwords"};
+
+    // Signature found at the beginning of compiled wordlists files.
+    static constexpr std::array<char, 8> _compiled_magic{'N', 'N', 'G', 'W',
+                                                         'O', 'R', 'D', 'S'};
+
+    // Version of the compiled wordlists file format.
+    static constexpr std::uint32_t _compiled_version{2};
+
+    // Read back in a different order when the file was compiled on a machine
+    // with different endianness.
+    static constexpr std::uint32_t _compiled_byte_order{0x01020304};
+
+    // Default folder to look for wordlists resources.
+    static const inline std::filesystem::path _default_resources_path{
+        R"(C:\Repos\nickname-generator\resources\)"};
+
+    // Contains all vowel characters.
+    static constexpr std::wstring_view _vowels{
+        L"aeiouáàâãäåæçèéêëìíîïðñòóôõöøšùúûüýÿ"};
+
+    // Contains every letter that can be leetified and its replacement.
+    static constexpr std::array<std::pair<wchar_t, wchar_t>, 18> _leet_map{
+        {{L'o', L'0'}, {L'O', L'0'}, {L'i', L'1'}, {L'I', L'1'}, {L's', L'2'},
+         {L'S', L'2'}, {L'e', L'3'}, {L'E', L'3'}, {L'a', L'4'}, {L'A', L'4'},
+         {L'g', L'6'}, {L'G', L'6'}, {L't', L'7'}, {L'T', L'7'}, {L'b', L'8'},
+         {L'B', L'8'}, {L'q', L'9'}, {L'Q', L'9'}}};
+
+    // Traits of a single character used by the nickname transforms, value
+    // initialized traits describe a character without any special trait.
+    struct character_traits
+    {
+        // Whether the character is a vowel.
+        bool vowel;
+
+        // Leetified replacement of the character, null if it has none.
+        wchar_t leet;
+    };
+
+    // Traits of every character in the Latin-1 range, generated at compile
+    // time from the vowels and leet replacements.
+    static constexpr std::array<character_traits, 256> _latin1_traits{[] {
+        // Traits being generated.
+        std::array<character_traits, 256> traits{};
+
+        for (const auto& vowel : _vowels)
+        {
+            if (static_cast<std::uint32_t>(vowel) < traits.size())
+            {
+                traits[static_cast<std::uint32_t>(vowel)].vowel = true;
+            }
+        }
+
+        for (const auto& [letter, replacement] : _leet_map)
+        {
+            traits[static_cast<std::uint32_t>(letter)].leet = replacement;
+        }
+
+        return traits;
+    }()};
+
+    // Whether the character is a vowel, in constant time for the Latin-1
+    // range.
+    static constexpr bool is_vowel(wchar_t character)
+    {
+        return (static_cast<std::uint32_t>(character) < _latin1_traits.size())
+                   ? _latin1_traits[static_cast<std::uint32_t>(character)].vowel
+                   : (_vowels.find(character) != std::wstring_view::npos);
+    }
+
+    // Leetified replacement of the character, null if it has none. Every
+    // leetifiable letter is in the Latin-1 range.
+    static constexpr wchar_t leet(wchar_t character)
+    {
+        return (static_cast<std::uint32_t>(character) < _latin1_traits.size())
+                   ? _latin1_traits[static_cast<std::uint32_t>(character)].leet
+                   : L'\0';
+    }
+
+    // Every leet replacement is shared by the lower and upper case versions
+    // of its letter, allowing the leet kernels to fold the case of ASCII
+    // letters before looking them up.
+    static_assert([] {
+        for (const auto& [letter, replacement] : _leet_map)
+        {
+            if (((letter | 0x20) < L'a') || ((letter | 0x20) > L'z') ||
+                (_latin1_traits[static_cast<std::uint32_t>(letter ^ 0x20)]
+                     .leet != replacement))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }());
+
+    // Converts the case of each character, the bit of the pattern matching
+    // the character position (modulo 64) tells whether it becomes upper case,
+    // otherwise it becomes lower case. One character at a time.
+    static void convert_case_scalar(wchar_t* characters, std::size_t size,
+                                    std::uint64_t upper_pattern,
+                                    std::size_t first_position = 0)
+    {
+        for (std::size_t i{first_position}; i < size; i++)
+        {
+            characters[i] = ((upper_pattern >> (i % 64)) & 1)
+                                ? std::towupper(characters[i])
+                                : std::towlower(characters[i]);
+        }
+    }
+
+    // Replaces every leetifiable letter by its numerical character. One
+    // character at a time.
+    static void leet_scalar(wchar_t* characters, std::size_t size,
+                            std::size_t first_position = 0)
+    {
+        for (std::size_t i{first_position}; i < size; i++)
+        {
+            // Leetified replacement of the character.
+            const wchar_t replacement{leet(characters[i])};
+
+            if (replacement != L'\0')
+            {
+                characters[i] = replacement;
+            }
+        }
+    }
+
+#if defined(__x86_64__) && (__SIZEOF_WCHAR_T__ == 4)
+    // Whether the processor supports AVX2 instructions.
+    static bool has_avx2()
+    {
+        static const bool supported{__builtin_cpu_supports("avx2") != 0};
+
+        return supported;
+    }
+
+    // Converts the case of each character following the pattern, ASCII
+    // characters are converted four at a time and every other character is
+    // converted by the C library.
+    static void convert_case_sse2(wchar_t* characters, std::size_t size,
+                                  std::uint64_t upper_pattern)
+    {
+        // Bit of the pattern owned by each lane.
+        const __m128i lane_bits{_mm_setr_epi32(1, 2, 4, 8)};
+
+        // Position of the next four characters.
+        std::size_t i{0};
+
+        for (; i + 4 <= size; i += 4)
+        {
+            // Four characters being converted.
+            __m128i block{_mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(characters + i))};
+
+            // Lanes whose character becomes upper case.
+            const __m128i upper_lanes{_mm_cmpeq_epi32(
+                _mm_and_si128(
+                    _mm_set1_epi32(static_cast<int>(
+                        (upper_pattern >> (i % 64)) & 0xF)),
+                    lane_bits),
+                lane_bits)};
+
+            // Lanes holding lower and upper case ASCII letters.
+            const __m128i from_a{_mm_sub_epi32(block, _mm_set1_epi32(L'a'))};
+            const __m128i from_upper_a{
+                _mm_sub_epi32(block, _mm_set1_epi32(L'A'))};
+            const __m128i lower_letters{_mm_andnot_si128(
+                _mm_cmplt_epi32(from_a, _mm_setzero_si128()),
+                _mm_cmplt_epi32(from_a, _mm_set1_epi32(26)))};
+            const __m128i upper_letters{_mm_andnot_si128(
+                _mm_cmplt_epi32(from_upper_a, _mm_setzero_si128()),
+                _mm_cmplt_epi32(from_upper_a, _mm_set1_epi32(26)))};
+
+            // Distance to the converted letter, zero for anything else.
+            const __m128i delta{_mm_or_si128(
+                _mm_and_si128(_mm_and_si128(upper_lanes, lower_letters),
+                              _mm_set1_epi32(-0x20)),
+                _mm_and_si128(_mm_andnot_si128(upper_lanes, upper_letters),
+                              _mm_set1_epi32(0x20)))};
+
+            block = _mm_add_epi32(block, delta);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(characters + i),
+                             block);
+
+            // Lanes holding characters outside the ASCII range.
+            const int non_ascii{_mm_movemask_ps(_mm_castsi128_ps(
+                _mm_cmpgt_epi32(block, _mm_set1_epi32(0x7F))))};
+
+            for (int lane{0}; lane < 4; lane++)
+            {
+                if ((non_ascii >> lane) & 1)
+                {
+                    convert_case_scalar(characters, i + lane + 1,
+                                        upper_pattern, i + lane);
+                }
+            }
+        }
+
+        convert_case_scalar(characters, size, upper_pattern, i);
+    }
+
+    // Converts the case of each character following the pattern, ASCII
+    // characters are converted eight at a time and every other character is
+    // converted by the C library.
+    __attribute__((target("avx2"))) static void convert_case_avx2(
+        wchar_t* characters, std::size_t size, std::uint64_t upper_pattern)
+    {
+        // Bit of the pattern owned by each lane.
+        const __m256i lane_bits{
+            _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128)};
+
+        // Position of the next eight characters.
+        std::size_t i{0};
+
+        for (; i + 8 <= size; i += 8)
+        {
+            // Eight characters being converted.
+            __m256i block{_mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(characters + i))};
+
+            // Lanes whose character becomes upper case.
+            const __m256i upper_lanes{_mm256_cmpeq_epi32(
+                _mm256_and_si256(
+                    _mm256_set1_epi32(static_cast<int>(
+                        (upper_pattern >> (i % 64)) & 0xFF)),
+                    lane_bits),
+                lane_bits)};
+
+            // Lanes holding lower and upper case ASCII letters.
+            const __m256i from_a{
+                _mm256_sub_epi32(block, _mm256_set1_epi32(L'a'))};
+            const __m256i from_upper_a{
+                _mm256_sub_epi32(block, _mm256_set1_epi32(L'A'))};
+            const __m256i lower_letters{_mm256_andnot_si256(
+                _mm256_cmpgt_epi32(_mm256_setzero_si256(), from_a),
+                _mm256_cmpgt_epi32(_mm256_set1_epi32(26), from_a))};
+            const __m256i upper_letters{_mm256_andnot_si256(
+                _mm256_cmpgt_epi32(_mm256_setzero_si256(), from_upper_a),
+                _mm256_cmpgt_epi32(_mm256_set1_epi32(26), from_upper_a))};
+
+            // Distance to the converted letter, zero for anything else.
+            const __m256i delta{_mm256_or_si256(
+                _mm256_and_si256(_mm256_and_si256(upper_lanes, lower_letters),
+                                 _mm256_set1_epi32(-0x20)),
+                _mm256_and_si256(
+                    _mm256_andnot_si256(upper_lanes, upper_letters),
+                    _mm256_set1_epi32(0x20)))};
+
+            block = _mm256_add_epi32(block, delta);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(characters + i),
+                                block);
+
+            // Lanes holding characters outside the ASCII range.
+            const int non_ascii{_mm256_movemask_ps(_mm256_castsi256_ps(
+                _mm256_cmpgt_epi32(block, _mm256_set1_epi32(0x7F))))};
+
+            for (int lane{0}; lane < 8; lane++)
+            {
+                if ((non_ascii >> lane) & 1)
+                {
+                    convert_case_scalar(characters, i + lane + 1,
+                                        upper_pattern, i + lane);
+                }
+            }
+        }
+
+        convert_case_scalar(characters, size, upper_pattern, i);
+    }
+
+    // Lower case leetifiable letters and their replacements, every upper case
+    // letter shares the replacement of its lower case version.
+    static constexpr auto _leet_letters{[] {
+        // Lower case letters and their replacements.
+        std::array<std::pair<wchar_t, wchar_t>, _leet_map.size() / 2> letters{};
+
+        // Amount of lower case letters found.
+        std::size_t count{0};
+
+        for (const auto& pair : _leet_map)
+        {
+            if (pair.first == (pair.first | 0x20))
+            {
+                letters[count++] = pair;
+            }
+        }
+
+        return letters;
+    }()};
+
+    // Replacement of each letter from a to z, split into two halves.
+    static constexpr auto _leet_alphabet{[] {
+        // Replacement of each letter, zero if it has none.
+        std::array<char, 32> alphabet{};
+
+        for (const auto& [letter, replacement] : _leet_letters)
+        {
+            alphabet[letter - L'a'] = static_cast<char>(replacement);
+        }
+
+        return alphabet;
+    }()};
+
+    // Replaces every leetifiable letter by its numerical character, four
+    // characters at a time.
+    static void leet_sse2(wchar_t* characters, std::size_t size)
+    {
+        // Position of the next four characters.
+        std::size_t i{0};
+
+        for (; i + 4 <= size; i += 4)
+        {
+            // Four characters being leetified.
+            const __m128i block{_mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(characters + i))};
+
+            // Characters with ASCII letters folded to lower case.
+            const __m128i folded{_mm_or_si128(block, _mm_set1_epi32(0x20))};
+
+            // Replacement of each character, zero if it has none. Every
+            // letter is compared independently to avoid a dependency chain.
+            const __m128i replacements{[&folded]<std::size_t... letter>(
+                                           std::index_sequence<letter...>) {
+                // Replacements found so far, combined through intrinsics
+                // only since vector operators aren't portable.
+                __m128i combined{_mm_setzero_si128()};
+
+                ((combined = _mm_or_si128(
+                      combined,
+                      _mm_and_si128(
+                          _mm_cmpeq_epi32(
+                              folded,
+                              _mm_set1_epi32(_leet_letters[letter].first)),
+                          _mm_set1_epi32(_leet_letters[letter].second)))),
+                 ...);
+
+                return combined;
+            }(std::make_index_sequence<_leet_letters.size()>{})};
+
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(characters + i),
+                _mm_or_si128(
+                    _mm_and_si128(
+                        _mm_cmpeq_epi32(replacements, _mm_setzero_si128()),
+                        block),
+                    replacements));
+        }
+
+        leet_scalar(characters, size, i);
+    }
+
+    // Replaces every leetifiable letter by its numerical character, eight
+    // characters at a time, looking up the replacements with byte shuffles.
+    __attribute__((target("avx2"))) static void leet_avx2(
+        wchar_t* characters, std::size_t size)
+    {
+        // Replacements of the first and last sixteen letters, in both halves
+        // of the register.
+        const __m256i first_letters{_mm256_broadcastsi128_si256(_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(_leet_alphabet.data())))};
+        const __m256i last_letters{_mm256_broadcastsi128_si256(_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(_leet_alphabet.data() + 16)))};
+
+        // Position of the next eight characters.
+        std::size_t i{0};
+
+        for (; i + 8 <= size; i += 8)
+        {
+            // Eight characters being leetified.
+            const __m256i block{_mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(characters + i))};
+
+            // Position of each character in the alphabet, folding the case
+            // of ASCII letters.
+            const __m256i letter{_mm256_sub_epi32(
+                _mm256_or_si256(block, _mm256_set1_epi32(0x20)),
+                _mm256_set1_epi32(L'a'))};
+
+            // Lanes holding a letter of the alphabet.
+            const __m256i in_alphabet{_mm256_andnot_si256(
+                _mm256_cmpgt_epi32(_mm256_setzero_si256(), letter),
+                _mm256_cmpgt_epi32(_mm256_set1_epi32(26), letter))};
+
+            // Shuffle indexes reading the letter replacement into the lowest
+            // byte of each lane, the other bytes are zeroed.
+            const __m256i indexes{_mm256_or_si256(
+                _mm256_and_si256(letter, _mm256_set1_epi32(0x0F)),
+                _mm256_set1_epi32(static_cast<int>(0x80808000)))};
+
+            // Replacement of each character, zero if it has none.
+            const __m256i replacements{_mm256_and_si256(
+                _mm256_blendv_epi8(
+                    _mm256_shuffle_epi8(first_letters, indexes),
+                    _mm256_shuffle_epi8(last_letters, indexes),
+                    _mm256_cmpgt_epi32(letter, _mm256_set1_epi32(15))),
+                in_alphabet)};
+
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(characters + i),
+                _mm256_blendv_epi8(
+                    replacements, block,
+                    _mm256_cmpeq_epi32(replacements, _mm256_setzero_si256())));
+        }
+
+        leet_scalar(characters, size, i);
+    }
+#endif
+
+    // Converts the case of each character following the pattern, using the
+    // widest instructions supported by the processor.
+    static void convert_case(wchar_t* characters, std::size_t size,
+                             std::uint64_t upper_pattern)
+    {
+#if defined(__x86_64__) && (__SIZEOF_WCHAR_T__ == 4)
+        if (has_avx2())
+        {
+            convert_case_avx2(characters, size, upper_pattern);
+        }
+        else
+        {
+            convert_case_sse2(characters, size, upper_pattern);
+        }
+#else
+        convert_case_scalar(characters, size, upper_pattern);
+#endif
+    }
+
+    // Replaces every leetifiable letter by its numerical character, using the
+    // widest instructions supported by the processor.
+    static void leet_all(wchar_t* characters, std::size_t size)
+    {
+#if defined(__x86_64__) && (__SIZEOF_WCHAR_T__ == 4)
+        if (has_avx2())
+        {
+            leet_avx2(characters, size);
+        }
+        else
+        {
+            leet_sse2(characters, size);
+        }
+#else
+        leet_scalar(characters, size);
+#endif
+    }
+
+    // Immutable snapshot of the wordlists, replaced as a whole whenever they
+    // change so generating threads never see a partial load.
+    std::shared_ptr<const wordlists_snapshot> _wordlists{
+        std::make_shared<const wordlists_snapshot>()};
+
+    // Guards the wordlists snapshot pointer, only ever held to copy or swap
+    // it, which generating threads do once per published snapshot.
+    mutable std::mutex _snapshot_guard;
+
+    // Version of the wordlists snapshot, increased on every change.
+    std::atomic<std::uint64_t> _version{0};
+
+    // Serializes the changes to the wordlists.
+    std::mutex _writer;
+
+    // Whether every nickname generated must differ from the issued ones.
+    std::atomic<bool> _unique{false};
+
+    // Hashes of every nickname issued by the uniqueness mode.
+    mutable hash_set _issued;
+
+    // Amount of nicknames issued by the uniqueness mode.
+    mutable std::atomic<std::uint64_t> _unique_issued{0};
+
+    // Amount of nicknames discarded for having been issued before or being
+    // reserved.
+    mutable std::atomic<std::uint64_t> _unique_retries{0};
+
+    // Amount of nicknames generated for a single allowed one before giving up.
+    static constexpr std::size_t _max_attempts{100};
+
+#ifdef DASMIG_NNG_STATS
+    // Guards the statistics of every thread.
+    mutable std::mutex _stats_guard;
+
+    // Statistics of each thread state of the generator.
+    mutable std::vector<std::shared_ptr<thread_stats>> _live_stats;
+
+    // Statistics of the thread states released since.
+    mutable retired_stats _retired_stats;
+#endif
+
+    // Amount of generator states each thread keeps.
+    static constexpr std::size_t _max_thread_states{16};
+
+    // Bytes read at a time from reserved nicknames files.
+    static constexpr std::size_t _reserve_chunk_size{1 << 16};
+
+    // Guards the thread states of the generator.
+    mutable std::mutex _thread_states_guard;
+
+    // States of the threads that used the generator, whose snapshots are
+    // released along with the generator.
+    mutable std::vector<std::weak_ptr<thread_state>> _thread_states;
+
+    // Amount of generators ever created, used to identify each one.
+    static inline std::atomic<std::uint64_t> _generators{0};
+
+    // Identifier of the generator, never shared with another one.
+    const std::uint64_t _id{_generators.fetch_add(1)};
+
+    // Seed every random stream of the generator derives from.
+    const std::uint64_t _seed;
+
+    // Amount of random streams created for the generator.
+    mutable std::atomic<std::uint64_t> _streams{0};
+
+    // Allows prepared names to be parsed alongside the strategies using them.
+    friend class prepared_name;
+
+#ifdef DASMIG_NNG_BENCHMARK
+    // Allows the benchmarks to measure each generation stage on its own,
+    // only declared when building them.
+    friend struct benchmark_access;
+#endif
+
+    // Add an x to either the front or back of the nickname - or both.
+    void xfy(std::wstring& nickname) const
+    {
+        // Distribution of possible xy, yx, xyx probability.
+        switch (bits().below(3))
+        {
+        case 0:
+            nickname.push_back(L'X');
+            break;
+        case 1:
+            nickname.insert(0, 1, L'X');
+            break;
+        case 2:
+            nickname.push_back(L'X');
+            nickname.insert(0, 1, L'X');
+            break;
+        default:
+            break;
+        }
+    }
+
+    // Writes the nickname backwards such as emankcin.
+    static void reverse(std::wstring& nickname)
+    {
+        std::reverse(std::begin(nickname), std::end(nickname));
+    }
+
+    // Adds an y to the end of nickname or replace the last character if it's a
+    // vowel.
+    static void yfy(std::wstring& nickname)
+    {
+        if (is_vowel(nickname.back()))
+        {
+            nickname.back() = L'y';
+        }
+        else
+        {
+            nickname.push_back(L'y');
+        }
+    }
+
+    // Adds a number to the end of nickname.
+    void numify(std::wstring& nickname) const
+    {
+        // Utilized to randomize digit added to the end of the nickname.
+        nickname.push_back(static_cast<wchar_t>(L'1' + bits().below(9)));
+
+        // Append n zeroes to the end of the nickname.
+        nickname.append(bits().take(2), L'0');
+    }
+
+    // Adds a trace to the end of the nickname.
+    static void tracefy(std::wstring& nickname)
+    {
+        nickname.push_back(L'-');
+    }
+
+    // Adds an ing to the end of nickname or replace the last character if it's
+    // a vowel.
+    static void ingify(std::wstring& nickname)
+    {
+        if (is_vowel(nickname.back()))
+        {
+            nickname.back() = L'i';
+            nickname.push_back(L'n');
+            nickname.push_back(L'g');
+        }
+        else
+        {
+            nickname.push_back(L'i');
+            nickname.push_back(L'n');
+            nickname.push_back(L'g');
+        }
+    }
+
+    // Finds an aeio vowel and duplicates it, keeps the same nickname if no
+    // available vowel.
+    static void duovowel(std::wstring& nickname)
+    {
+        static const std::wstring_view simple_vowels = L"aeio";
+
+        // Try duplicating each vowel in the nickname, stop after succeeding
+        // once.
+        for (const auto& vowel : simple_vowels)
+        {
+            // Position of vowel finded in the nickname.
+            const auto vowel_position{nickname.find(vowel)};
+
+            if (vowel_position != std::wstring::npos)
+            {
+                nickname.insert(vowel_position, 1, vowel);
+                break;
+            }
+        }
+    }
+
+    // Replaces a random letter by a numerical character.
+    void oneleet(std::wstring& nickname) const
+    {
+        // Positions of the first letters that can be leetified, stored on
+        // the stack.
+        std::array<std::size_t, _max_leet_candidates> candidates;
+
+        // Amount of letters that can be leetified, even beyond the stored
+        // ones.
+        std::size_t candidate_count{0};
+
+        for (std::size_t i{0}; i < nickname.size(); i++)
+        {
+            if (leet(nickname[i]) != L'\0')
+            {
+                if (candidate_count < candidates.size())
+                {
+                    candidates[candidate_count] = i;
+                }
+
+                candidate_count++;
+            }
+        }
+
+        if (candidate_count == 0)
+        {
+            return;
+        }
+
+        // Letter drawn among every candidate.
+        std::size_t drawn{bits().below(candidate_count)};
+
+        if (drawn < candidates.size())
+        {
+            nickname[candidates[drawn]] = leet(nickname[candidates[drawn]]);
+            return;
+        }
+
+        // Letters beyond the stored ones are found by searching again.
+        for (auto& character : nickname)
+        {
+            if ((leet(character) != L'\0') && (drawn-- == 0))
+            {
+                character = leet(character);
+                return;
+            }
+        }
+    }
+
+    // Replaces as much letters as possible in the nickname by numerical
+    // characters.
+    static void allleet(std::wstring& nickname)
+    {
+        // Replace all possible characters.
+        leet_all(nickname.data(), nickname.size());
+    }
+
+    // Finalizers able to change the nickname, one bit per finalizer in the
+    // order they're declared.
+    static unsigned applicable_finalizers(std::wstring_view nickname)
+    {
+        // Bit of each applicable finalizer.
+        unsigned applicable{0};
+
+        // Palindromes read the same reversed.
+        if (!std::equal(nickname.begin(),
+                        nickname.begin() + (nickname.size() / 2),
+                        nickname.rbegin()))
+        {
+            applicable |= 1U << static_cast<unsigned>(finalizer::reverse);
+        }
+
+        if (nickname.find_first_of(L"aeio") != std::wstring_view::npos)
+        {
+            applicable |= 1U << static_cast<unsigned>(finalizer::duovowel);
+        }
+
+        if (std::any_of(nickname.begin(), nickname.end(),
+                        [](wchar_t character) {
+                            return leet(character) != L'\0';
+                        }))
+        {
+            applicable |= 1U << static_cast<unsigned>(finalizer::oneleet);
+            applicable |= 1U << static_cast<unsigned>(finalizer::allleet);
+        }
+
+        return applicable;
+    }
+
+    // Slightly modify the nickname to add some flavor. A finalizer leaving
+    // the nickname equal to the original word forces another round, at most
+    // _max_leetify_rounds rounds are made.
+    void leetify(std::wstring& nickname, std::wstring_view original,
+                 bool force = false) const
+    {
+        for (std::size_t round{0}; round < _max_leetify_rounds; round++)
+        {
+            // We have 1/2 chance of leetifying, force parameter overrides
+            // this.
+            if (!force && !bits().coin())
+            {
+                count(_skipped_counter);
+                return;
+            }
+
+            // When leetifying, there's 1/2 chance of using a finalizer or a
+            // random leetifier, unless no finalizer can change the nickname.
+            if (bits().coin())
+            {
+                // Finalizers able to change the nickname.
+                unsigned applicable{applicable_finalizers(nickname)};
+
+                if (applicable != 0)
+                {
+                    // Each applicable finalizer is equally likely, the drawn
+                    // one is found by dropping the lower applicable ones.
+                    for (auto skipped{bits().below(
+                             static_cast<std::size_t>(
+                                 std::popcount(applicable)))};
+                         skipped > 0; skipped--)
+                    {
+                        applicable &= applicable - 1;
+                    }
+
+                    // Finalizer drawn.
+                    const auto drawn{static_cast<std::size_t>(
+                        std::countr_zero(applicable))};
+
+                    count(_finalizer_counters + drawn);
+
+                    switch (static_cast<finalizer>(drawn))
+                    {
+                    case finalizer::reverse:
+                        reverse(nickname); // emanckin
+                        break;
+                    case finalizer::duovowel:
+                        duovowel(nickname); // nicknamee
+                        break;
+                    case finalizer::oneleet:
+                        oneleet(nickname); // n1ckname
+                        break;
+                    case finalizer::allleet:
+                        allleet(nickname); // n1ckn4m3
+                        break;
+                    }
+
+                    // If the new nickname didn't suffer any alteration, force
+                    // leetify again.
+                    force = (nickname == original);
+
+                    if (force)
+                    {
+                        count(_forced_counter);
+                    }
+
+                    continue;
+                }
+            }
+
+            // Possible methods utilized to leetify the nickname, each one
+            // equally likely.
+            static constexpr alias_table<6> possible_leetifiers{
+                {1, 1, 1, 1, 1, 1}};
+
+            // Leetifier drawn.
+            const std::size_t drawn{possible_leetifiers.draw(bits())};
+
+            count(_leetifier_counters + drawn);
+
+            switch (static_cast<leetifier>(drawn))
+            {
+            case leetifier::xfy:
+                xfy(nickname); // nicknameX
+                break;
+            case leetifier::reverse:
+                reverse(nickname); // emanckin
+                break;
+            case leetifier::yfy:
+                yfy(nickname); // nicknamy
+                break;
+            case leetifier::numify:
+                numify(nickname); // nickname2000
+                break;
+            case leetifier::tracefy:
+                tracefy(nickname); // nickname-
+                break;
+            case leetifier::ingify:
+                ingify(nickname); // nicknaming
+                break;
+            }
+
+            return;
+        }
+
+        count(_exhausted_counter);
+    };
+
+    // Introduces an underscore separating the nickname original parts.
+    static void snake_case(std::wstring& name)
+    {
+        // Introduce an underscore if it's the begginning of a part of the
+        // nickname, except the first.
+        for (std::size_t i = 1; i < name.size(); i++)
+        {
+            if (iswupper(name.at(i)) != 0)
+            {
+                name.insert(i, 1, L'_');
+                i++;
+            }
+        }
+    };
+
+    // Transforms the nickname to all uppercase.
+    static void upper_case(std::wstring& name)
+    {
+        // Transform every character to uppercase if possible.
+        convert_case(name.data(), name.size(), ~std::uint64_t{0});
+    };
+
+    // Transforms the nickname to all lowercase.
+    static void lower_case(std::wstring& name)
+    {
+        // Transform every character to lower if possible.
+        convert_case(name.data(), name.size(), 0);
+    };
+
+    // Keeps the nickname in title case.
+    static void title_case(std::wstring& /*name*/)
+    {
+        // Well, titlecase is actually the default.
+    };
+
+    // Transforms the nickname to sentence case.
+    static void sentence_case(std::wstring& name)
+    {
+        lower_case(name);
+
+        // Transform the first character to upper case.
+        name.at(0) = std::towupper(name.at(0));
+    };
+
+    // Transforms the nickname to camel case.
+    static void camel_case(std::wstring& name)
+    {
+        // Transform the first character to lower case.
+        name.at(0) = std::towlower(name.at(0));
+    };
+
+    // Transforms the nickname to reverse sentence case.
+    static void reverse_sentence_case(std::wstring& name)
+    {
+        lower_case(name);
+
+        // Transform the last character to upper case.
+        name.back() = std::towupper(name.back());
+    };
+
+    // Transforms the nickname to bathtub case.
+    static void bathtub_case(std::wstring& name)
+    {
+        lower_case(name);
+
+        // Transform the first character to upper case.
+        name.at(0) = std::towupper(name.at(0));
+
+        // Transform the last character to upper case.
+        name.back() = std::towupper(name.back());
+    };
+
+    // Transforms the nickname to winding case.
+    static void winding_case(std::wstring& name)
+    {
+        // Transform to uppercase half of the letters, every even position.
+        convert_case(name.data(), name.size(), 0x5555555555555555);
+    };
+
+    // Transforms the nickname case in a random fashion.
+    void random_case(std::wstring& name) const
+    {
+        // Transform every character to upper if lucky, each random bit
+        // deciding the case of one character.
+        for (std::size_t i{0}; i < name.size(); i += 64)
+        {
+            // Characters converted by this chunk.
+            const std::size_t size{std::min<std::size_t>(64, name.size() - i)};
+
+            convert_case(name.data() + i, size, bits().take(size));
+        }
+    };
+
+    // Transforms the nickname to all lower case with a single random character
+    // uppercase.
+    void random_single_case(std::wstring& name) const
+    {
+        lower_case(name);
+
+        // Position of single random character to be uppercased.
+        auto& random_char{name[bits().below(name.size())]};
+
+        random_char = std::towupper(random_char);
+    };
 
     // Format nickname utilizing one of the possible cases.
-    static nickname format(nickname nickname)
+    void format(std::wstring& nickname) const
     {
         // 1% chance of snake case. nick_name
-        if (effolkronium::random_thread_local::get<bool>(0.01))
-        {
-            nickname._internal_string = snake_case(nickname);
-        }
-
-        // Possible methods utilized to format the nickname.
-        // Repeat functions to enforce a distribution.
-        static const generators possible_generators = {
-            upper_case,
-            upper_case,
-            upper_case,
-            upper_case, // NICKNAME
-            lower_case,
-            lower_case,
-            lower_case,
-            lower_case,
-            lower_case,
-            lower_case,
-            lower_case,
-            lower_case, // nickname
-            title_case,
-            title_case, // NickName
-            sentence_case,
-            sentence_case,
-            sentence_case,
-            sentence_case,
-            sentence_case, // Nickname
-            camel_case,
-            camel_case, // nickName
-            reverse_sentence_case,
-            reverse_sentence_case, // nicknamE
-            bathtub_case,
-            bathtub_case,
-            bathtub_case,      // NicknamE
-            winding_case,      // nIcKnAmE
-            random_case,       // niCKnaMe
-            random_single_case // nicknaMe
-        };
+        if (bits().chance(0.01))
+        {
+            count(_snake_case_counter);
+            snake_case(nickname);
+        }
+
+        // Possible methods utilized to format the nickname, weighted to
+        // enforce a distribution.
+        static constexpr alias_table<10> possible_formats{{
+            4, // upper_case
+            8, // lower_case
+            2, // title_case
+            5, // sentence_case
+            2, // camel_case
+            2, // reverse_sentence_case
+            3, // bathtub_case
+            1, // winding_case
+            1, // random_case
+            1  // random_single_case
+        }};
+
+        // Format drawn.
+        const std::size_t drawn{possible_formats.draw(bits())};
+
+        count(_format_counters + drawn);
+
+        switch (static_cast<case_format>(drawn))
+        {
+        case case_format::upper_case:
+            upper_case(nickname); // NICKNAME
+            break;
+        case case_format::lower_case:
+            lower_case(nickname); // nickname
+            break;
+        case case_format::title_case:
+            title_case(nickname); // NickName
+            break;
+        case case_format::sentence_case:
+            sentence_case(nickname); // Nickname
+            break;
+        case case_format::camel_case:
+            camel_case(nickname); // nickName
+            break;
+        case case_format::reverse_sentence_case:
+            reverse_sentence_case(nickname); // nicknamE
+            break;
+        case case_format::bathtub_case:
+            bathtub_case(nickname); // NicknamE
+            break;
+        case case_format::winding_case:
+            winding_case(nickname); // nIcKnAmE
+            break;
+        case case_format::random_case:
+            random_case(nickname); // niCKnaMe
+            break;
+        case case_format::random_single_case:
+            random_single_case(nickname); // nicknaMe
+            break;
+        }
+    };
+
+    // Memory resource of the allocator, the default one for allocators not
+    // using memory resources.
+    template <typename Allocator>
+    static std::pmr::memory_resource* resource_of(const Allocator& allocator)
+    {
+        if constexpr (requires { allocator.resource(); })
+        {
+            return allocator.resource();
+        }
+        else
+        {
+            return std::pmr::get_default_resource();
+        }
+    }
+
+    // Prepares the received name, avoiding any allocation when there's no
+    // name to prepare.
+    static prepared_name prepare(std::wstring_view name,
+                                 std::pmr::memory_resource* resource =
+                                     std::pmr::get_default_resource())
+    {
+        return name.empty() ? prepared_name{}
+                            : prepared_name{name, resource};
+    }
+
+    // Splits a full name into each name/surname and caches the result of
+    // every name based strategy that doesn't depend on chance.
+    static std::shared_ptr<const prepared_name::parsed> parse_name(
+        std::wstring_view name, std::pmr::memory_resource* resource)
+    {
+        // Parsed name, allocated from the resource to keep its views valid
+        // when shared.
+        auto parsed_name{std::allocate_shared<prepared_name::parsed>(
+            std::pmr::polymorphic_allocator<>{resource}, resource)};
+
+        // Full name followed by every cached strategy result, a single name
+        // takes the most space since it's repeated by every cached result.
+        std::pmr::wstring& characters{parsed_name->characters};
+
+        characters.reserve((name.size() * 4) + 3);
+        characters.assign(name);
+
+        // Position and size of each name/surname, followed by each reduced
+        // name/surname, views are only taken after every cached result has
+        // been written.
+        std::pmr::vector<std::pair<std::size_t, std::size_t>> spans{resource};
+
+        spans.reserve(2 * (std::count(name.cbegin(), name.cend(), L' ') + 1));
+
+        // Position where the current name/surname starts.
+        std::size_t part_start{0};
+
+        while (part_start < name.size())
+        {
+            // Position right after the current name/surname.
+            std::size_t part_end{name.find(L' ', part_start)};
+
+            if (part_end == std::wstring_view::npos)
+            {
+                part_end = name.size();
+            }
+
+            // Consecutive spaces don't delimit an actual name.
+            if (part_end > part_start)
+            {
+                spans.emplace_back(part_start, part_end - part_start);
+            }
+
+            part_start = part_end + 1;
+        }
+
+        parsed_name->part_count = spans.size();
+
+        // Position and size of the initials, first name plus initial and
+        // initial plus last name.
+        std::array<std::pair<std::size_t, std::size_t>, 3> cached{};
+
+        if (!spans.empty())
+        {
+            // First name and last surname.
+            const std::wstring_view first{name.data() + spans.front().first,
+                                          spans.front().second};
+            const std::wstring_view last{name.data() + spans.back().first,
+                                         spans.back().second};
+
+            cached[0].first = characters.size();
+
+            for (std::size_t i{0}; i < parsed_name->part_count; i++)
+            {
+                characters.push_back(name[spans[i].first]);
+            }
+
+            cached[1].first = characters.size();
+            characters.append(first);
+            characters.push_back(last.front());
+
+            cached[2].first = characters.size();
+            characters.push_back(first.front());
+            characters.append(last);
+
+            cached[0].second = cached[1].first - cached[0].first;
+            cached[1].second = cached[2].first - cached[1].first;
+            cached[2].second = characters.size() - cached[2].first;
+        }
+
+        // Each name/surname reduced to their consonants.
+        for (std::size_t i{0}; i < parsed_name->part_count; i++)
+        {
+            // Position where the reduced name/surname starts.
+            const std::size_t reduced_start{characters.size()};
+
+            append_reduced({name.data() + spans[i].first, spans[i].second},
+                           characters);
+
+            spans.emplace_back(reduced_start,
+                               characters.size() - reduced_start);
+        }
+
+        // Views into the final characters.
+        const std::wstring_view all_characters{characters};
+
+        parsed_name->name = all_characters.substr(0, name.size());
+        parsed_name->initials =
+            all_characters.substr(cached[0].first, cached[0].second);
+        parsed_name->first_plus_initial =
+            all_characters.substr(cached[1].first, cached[1].second);
+        parsed_name->initial_plus_last =
+            all_characters.substr(cached[2].first, cached[2].second);
+
+        parsed_name->views.reserve(spans.size());
+
+        for (const auto& [position, size] : spans)
+        {
+            parsed_name->views.push_back(all_characters.substr(position, size));
+        }
+
+        return parsed_name;
+    }
+
+    // Uses the first name.
+    static void first_name(const name_view& name, std::wstring& nickname)
+    {
+        nickname.assign(name.parts.front());
+    };
+
+    // Uses the last surname.
+    static void last_name(const name_view& name, std::wstring& nickname)
+    {
+        nickname.assign(name.parts.back());
+    };
+
+    // Uses any name (until it hits a space character).
+    void any_name(const name_view& name, std::wstring& nickname) const
+    {
+        nickname.assign(name.parts[bits().below(name.parts.size())]);
+    };
+
+    // Uses only the name initials.
+    static void initials(const name_view& name, std::wstring& nickname)
+    {
+        if (name.cached != nullptr)
+        {
+            nickname.assign(name.cached->initials);
+            return;
+        }
+
+        nickname.clear();
+
+        for (const auto& part : name.parts)
+        {
+            nickname.push_back(part.front());
+        }
+    };
+
+    // Mix the last two names.
+    void mix_two(const name_view& name, std::wstring& nickname) const
+    {
+        // Last two names, or the single name.
+        const auto names{
+            name.parts.last(std::min<std::size_t>(2, name.parts.size()))};
+
+        nickname.clear();
+
+        // Iterate through the last two names retrieving random number of
+        // letters.
+        for (const auto& single_name : names)
+        {
+            // Shortest amount of letters retrieved.
+            const std::size_t minimum{
+                std::min<std::size_t>(2, single_name.size())};
+
+            nickname.append(single_name.substr(
+                0, minimum + bits().below(single_name.size() - minimum + 1)));
+        }
+    };
+
+    // Mix first name with last name initial.
+    static void first_plus_initial(const name_view& name,
+                                   std::wstring& nickname)
+    {
+        if (name.cached != nullptr)
+        {
+            nickname.assign(name.cached->first_plus_initial);
+            return;
+        }
+
+        nickname.assign(name.parts.front());
+        nickname.push_back(name.parts.back().front());
+    }
+
+    // Mix last name with first name initial.
+    static void initial_plus_last(const name_view& name,
+                                  std::wstring& nickname)
+    {
+        if (name.cached != nullptr)
+        {
+            nickname.assign(name.cached->initial_plus_last);
+            return;
+        }
+
+        nickname.assign(1, name.parts.front().front());
+        nickname.append(name.parts.back());
+    }
+
+    // Reduce a random part of the name.
+    void reduce_single_name(const name_view& name,
+                            std::wstring& nickname) const
+    {
+        // Position of the name/surname reduced.
+        const std::size_t drawn{bits().below(name.parts.size())};
+
+        if (name.cached != nullptr)
+        {
+            nickname.assign(name.cached->views[name.parts.size() + drawn]);
+            return;
+        }
+
+        nickname.clear();
+        append_reduced(name.parts[drawn], nickname);
+    }
+
+    // Appends the name/surname without its vowels unless it's already small
+    // enough, keeping its first and last characters.
+    template <typename String>
+    static void append_reduced(std::wstring_view part, String& output)
+    {
+        if (part.size() <= 3)
+        {
+            output.append(part);
+            return;
+        }
+
+        output.push_back(part.front());
+
+        for (const auto& character : part.substr(1, part.size() - 2))
+        {
+            if (!is_vowel(character))
+            {
+                output.push_back(character);
+            }
+        }
+
+        output.push_back(part.back());
+    }
+
+    // View of the prepared name, reading its cached strategy results.
+    static name_view view(const prepared_name& name)
+    {
+        return {name.full(), name.parts(), name._parsed.get()};
+    }
+
+    // Generates a nickname from a prepared name into the output.
+    void generate(const prepared_name& name, nickname& output) const
+    {
+        generate(view(name), output);
+    }
+
+    // Generates a nickname from a name split on the stack into the output,
+    // computing only the result of the drawn strategy. Names with more parts
+    // than fit on the stack are prepared instead.
+    void generate(std::wstring_view name, nickname& output) const
+    {
+        // Each name/surname composing the full name.
+        std::array<std::wstring_view, _max_split_parts> parts;
+
+        // Amount of names/surnames composing the full name.
+        std::size_t part_count{0};
+
+        // Position where the current name/surname starts.
+        std::size_t part_start{0};
+
+        while (part_start < name.size())
+        {
+            // Position right after the current name/surname.
+            std::size_t part_end{name.find(L' ', part_start)};
+
+            if (part_end == std::wstring_view::npos)
+            {
+                part_end = name.size();
+            }
+
+            // Consecutive spaces don't delimit an actual name.
+            if (part_end > part_start)
+            {
+                if (part_count == parts.size())
+                {
+                    generate(prepare(name, output.get_allocator().resource()),
+                             output);
+                    return;
+                }
+
+                parts[part_count++] =
+                    name.substr(part_start, part_end - part_start);
+            }
+
+            part_start = part_end + 1;
+        }
+
+        generate(name_view{name, std::span{parts.data(), part_count}}, output);
+    }
+
+    // Generates a nickname into the output, generating it again while it is
+    // reserved or, when the uniqueness mode is enabled, already issued.
+    void generate(const name_view& name, nickname& output) const
+    {
+        // Wordlists snapshot seen by the thread, alive until it sees a newer
+        // one, so the same one is used by every attempt.
+        const wordlists_snapshot& loaded{wordlists()};
+
+        // Whether every issued nickname must be remembered.
+        const bool unique{_unique.load(std::memory_order_relaxed)};
+
+        time_next_nickname();
+
+        // Moment the nickname started being generated.
+        const auto generating{stage_start()};
+
+        solver(loaded, name, output);
+
+        if (!unique && loaded.reserved.empty())
+        {
+            stage_end(_generate_latency, generating);
+            return;
+        }
+
+        for (std::size_t attempt{1};; attempt++)
+        {
+            // Hash of the nickname part.
+            const std::uint64_t issued{hash(std::wstring_view{
+                output._strings.data(), output._nickname_size})};
+
+            // Whether any filter matches the nickname.
+            const bool reserved{std::any_of(
+                loaded.reserved.begin(), loaded.reserved.end(),
+                [issued](const auto& filter) {
+                    return filter->contains(issued);
+                })};
+
+            if (!reserved && (!unique || _issued.insert(issued)))
+            {
+                break;
+            }
+
+            _unique_retries.fetch_add(1, std::memory_order_relaxed);
+
+            if (attempt == _max_attempts)
+            {
+                throw(std::runtime_error(
+                    "Unable to generate an available nickname"));
+            }
+
+            solver(loaded, name, output);
+        }
+
+        if (unique)
+        {
+            _unique_issued.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        stage_end(_generate_latency, generating);
+    }
+
+    // Hash of the nickname, FNV-1a over its characters followed by the
+    // splitmix64 finalizer to spread the bits choosing shards and slots.
+    static std::uint64_t hash(std::wstring_view characters)
+    {
+        // Hash of every character so far.
+        std::uint64_t value{0xCBF29CE484222325};
+
+        for (const auto& character : characters)
+        {
+            value ^= static_cast<std::uint32_t>(character);
+            value *= 0x100000001B3;
+        }
+
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+
+        return value ^ (value >> 31);
+    }
+
+    // Contains logic to generate a random nickname optionally based on the
+    // player full name, storing it into the received nickname. Words are
+    // drawn from the received snapshot, which outlives the original word.
+    void solver(const wordlists_snapshot& loaded, const name_view& name,
+                nickname& output) const
+    {
+        // Nickname being modified, kept between calls so its memory is reused
+        // by every nickname generated in the thread.
+        thread_local std::wstring nick;
+
+        // Holds the original word used to generate the nickname.
+        std::wstring_view original;
+
+        // Moment the original word started being selected.
+        const auto selecting{stage_start()};
+
+        // 1/4 chance of nickname being name related.
+        const std::double_t name_related_probability{0.25};
 
-        nickname._internal_string = (*effolkronium::random_thread_local::get(
-            possible_generators))(nickname);
+        // Proceed to generate nickname based on name.
+        if (!name.empty() && bits().chance(name_related_probability))
+        {
+            // Possible methods utilized to generate a nickname, each one
+            // equally likely. Any name purposefully adds redundancy to first
+            // and last name to add double weight to them.
+            static constexpr alias_table<8> possible_strategies{
+                {1, 1, 1, 1, 1, 1, 1, 1}};
 
-        return nickname;
-    };
+            original = name.full;
 
-    // Split a full name into a vector containing each name/surname.
-    static std::vector<std::wstring> split_name(const std::wstring& name)
-    {
-        // Container with names/surnames split by space character.
-        std::vector<std::wstring> splitted_name;
+            // Strategy drawn.
+            const std::size_t drawn{possible_strategies.draw(bits())};
+
+            count(_strategy_counters + drawn);
+
+            // Generate a nickname from one of the name based possibilities.
+            switch (static_cast<name_strategy>(drawn))
+            {
+            case name_strategy::first_name:
+                first_name(name, nick); // John
+                break;
+            case name_strategy::last_name:
+                last_name(name, nick); // Doe
+                break;
+            case name_strategy::any_name:
+                any_name(name, nick); // Smith
+                break;
+            case name_strategy::initials:
+                initials(name, nick); // JSD
+                break;
+            case name_strategy::mix_two:
+                mix_two(name, nick); // DoSmi
+                break;
+            case name_strategy::initial_plus_last:
+                initial_plus_last(name, nick); // JSmith
+                break;
+            case name_strategy::first_plus_initial:
+                first_plus_initial(name, nick); // JohnS
+                break;
+            case name_strategy::reduce_single_name:
+                reduce_single_name(name, nick); // Jhn
+                break;
+            }
+        }
+        // Proceed to generate nickname based on a word list.
+        else if (!loaded.lists.empty())
+        {
+            // Randomly select a worldist according to its weight, referencing
+            // it in place instead of copying every word it contains.
+            const wordlist& drawn_wordlist =
+                loaded.lists[draw(loaded.index, loaded.lists.size())];
 
-        // String to ease the name splitting.
-        std::wstringstream full_name_stream{name};
+            // Randomly selects a word from the wordlist according to its
+            // weight, by index.
+            original = drawn_wordlist[draw(drawn_wordlist.weights(),
+                                           drawn_wordlist.size())];
 
-        // Single part of the full name.
-        std::wstring single_name;
+            nick.assign(original);
 
-        while (std::getline(full_name_stream, single_name, L' '))
+            count(_wordlist_counter);
+        }
+        else
         {
-            splitted_name.push_back(single_name);
+            throw(std::invalid_argument(
+                "Received no name and word lists are empty"));
         }
 
-        return splitted_name;
-    };
+        // Moment the nickname started being leetified.
+        const auto leetifying{stage_end(_select_latency, selecting)};
 
-    // Returns the first name.
-    static std::wstring first_name(const std::wstring& name)
-    {
-        return *(split_name(name).cbegin());
+        // Amount of forced leetify retries before this nickname.
+        const std::uint64_t forced{counted(_forced_counter)};
+
+        leetify(nick, original);
+
+        count(_depth_counters +
+              std::min<std::size_t>(counted(_forced_counter) - forced,
+                                    _max_counted_depth));
+
+        // Moment the nickname started being formatted.
+        const auto formatting{stage_end(_leetify_latency, leetifying)};
+
+        format(nick);
+
+        stage_end(_format_latency, formatting);
+
+        // Store both strings in the nickname memory, reusing it if possible.
+        output._strings.reserve(nick.size() + original.size());
+        output._strings.assign(nick);
+        output._strings.append(original);
+        output._nickname_size = nick.size();
     };
 
-    // Returns the last surname.
-    static std::wstring last_name(const std::wstring& name)
+    // Reads every wordlist found in the received resource path.
+    static std::vector<wordlist> read_resources(
+        const std::filesystem::path& resource_path,
+        std::vector<file_load>& report)
     {
-        return *(split_name(name).crbegin());
-    };
+        // Wordlists containing at least a single word.
+        std::vector<wordlist> wordlists;
 
-    // Returns any name (until it hits a space character).
-    static std::wstring any_name(const std::wstring& name)
+        if (std::filesystem::is_directory(resource_path))
+        {
+            // Wordlists files found, sorted so their lists are always merged
+            // in the same order.
+            std::vector<std::filesystem::path> files;
+
+            for (const auto& entry :
+                 std::filesystem::recursive_directory_iterator(resource_path))
+            {
+                if (entry.is_regular_file() &&
+                    (entry.path().extension() == ".words"))
+                {
+                    files.push_back(entry.path());
+                }
+            }
+
+            std::sort(files.begin(), files.end());
+
+            for (auto& words : parse_files(files, report))
+            {
+                if (!words.empty())
+                {
+                    wordlists.push_back(std::move(words));
+                }
+            }
+        }
+        else if (std::filesystem::is_regular_file(resource_path) &&
+                 (resource_path.extension() == _compiled_extension))
+        {
+            // Moment the compiled file started being attached.
+            const auto start{std::chrono::steady_clock::now()};
+
+            wordlists = attach_compiled(resource_path);
+
+            // Amount of words in every attached list.
+            std::size_t words{0};
+
+            for (const auto& attached : wordlists)
+            {
+                words += attached.size();
+            }
+
+            report.push_back({resource_path, words,
+                              std::chrono::steady_clock::now() - start});
+        }
+
+        return wordlists;
+    }
+
+    // Parses every received file concurrently, one file per thread at a time,
+    // returning their lists in the same order as the files. Throws once every
+    // file is parsed if any of them holds a malformed weight.
+    static std::vector<wordlist> parse_files(
+        const std::vector<std::filesystem::path>& files,
+        std::vector<file_load>& report)
     {
-        // Container with names/surnames that compose the received name.
-        std::vector<std::wstring> names_list{split_name(name)};
+        // Words read from each file.
+        std::vector<wordlist> parsed(files.size());
 
-        return *effolkronium::random_thread_local::get(names_list);
-    };
+        // Time taken reading each file.
+        std::vector<file_load> timings(files.size());
+
+        // Failure reading each file, rethrown once every thread is done.
+        std::vector<std::exception_ptr> failures(files.size());
+
+        // Position of the next file to be parsed by any thread.
+        std::atomic<std::size_t> next{0};
+
+        // Parses files until there are none left.
+        const auto parse{[&] {
+            for (std::size_t i{next++}; i < files.size(); i = next++)
+            {
+                // Moment the file started being parsed.
+                const auto start{std::chrono::steady_clock::now()};
+
+                try
+                {
+                    parsed[i] = parse_file(files[i]);
+                }
+                catch (const std::invalid_argument& invalid)
+                {
+                    // Malformed weights are reported along with their file.
+                    failures[i] = std::make_exception_ptr(
+                        std::invalid_argument(std::string{invalid.what()} +
+                                              " in " + files[i].string()));
+                }
+                catch (...)
+                {
+                    failures[i] = std::current_exception();
+                }
+
+                timings[i] = {files[i], parsed[i].size(),
+                              std::chrono::steady_clock::now() - start};
+            }
+        }};
+
+        {
+            // Threads parsing alongside the calling one, joined at the end of
+            // the scope even if creating one of them fails.
+            std::vector<std::jthread> threads;
+
+            // Amount of threads parsing files, the calling one included.
+            const std::size_t thread_count{std::min<std::size_t>(
+                std::max(1u, std::thread::hardware_concurrency()),
+                files.size())};
+
+            for (std::size_t i{1}; i < thread_count; i++)
+            {
+                threads.emplace_back(parse);
+            }
 
-    // Returns only the name initials.
-    static std::wstring initials(const std::wstring& name)
+            parse();
+        }
+
+        for (const auto& failure : failures)
+        {
+            if (failure)
+            {
+                std::rethrow_exception(failure);
+            }
+        }
+
+        report.insert(report.end(), timings.begin(), timings.end());
+
+        return parsed;
+    }
+
+    // Try parsing the UTF-8 wordlist file, returns an empty list if it can't
+    // be opened. The file is copied with a single read rather than mapped, so
+    // it being truncated while reloading can't fault the parse.
+    static wordlist parse_file(const std::filesystem::path& file)
     {
-        // Generated nickname containing each name first letter.
-        std::wstring nickname;
+        std::ifstream input{file, std::ios::binary | std::ios::ate};
+
+        if (!input)
+        {
+            return {};
+        }
 
-        // Container with names/surnames that compose the received name.
-        std::vector<std::wstring> names_list{split_name(name)};
+        // Size of the file when opened.
+        const std::streamoff size{input.tellg()};
 
-        // Iterate through each name retrieving first letter.
-        for (const auto& name : names_list)
+        if (size <= 0)
         {
-            nickname.push_back(*(name.cbegin()));
+            return {};
         }
 
-        return nickname;
-    };
+        // Whole file contents.
+        std::string contents(static_cast<std::size_t>(size), '\0');
 
-    // Mix the last two names.
-    static std::wstring mix_two(const std::wstring& name)
+        input.seekg(0);
+        input.read(contents.data(), size);
+
+        // A file truncated since being opened is parsed up to its new end.
+        contents.resize(static_cast<std::size_t>(input.gcount()));
+
+        return parse_utf8({reinterpret_cast<const unsigned char*>(
+                               contents.data()),
+                           contents.size()});
+    }
+
+    // Parses UTF-8 text holding a word per line in a single pass, each word
+    // optionally followed by a tab and its positive integer weight. Byte
+    // order marks, carriage returns and blank lines are skipped, invalid
+    // sequences are replaced by U+FFFD.
+    static wordlist parse_utf8(std::span<const unsigned char> text)
     {
-        // Generated nickname containing a part the last two names.
-        std::wstring nickname;
+        // Every word read laid out back to back, no word takes more wide
+        // characters than bytes.
+        std::wstring characters(text.size(), L'\0');
+
+        // Amount of wide characters written.
+        std::size_t length{0};
+
+        // Position where each word starts, followed by the end of the last.
+        std::vector<std::uint32_t> offsets{0};
+
+        // Weight of each word, only filled once any word has a weight.
+        std::vector<std::uint32_t> weights;
+
+        // Weight of the word being read.
+        std::uint32_t weight{1};
+
+        // Ends the word being read, unless the line was blank.
+        const auto end_word{[&length, &offsets, &weights, &weight] {
+            if (length > offsets.back())
+            {
+                if (length > (std::numeric_limits<std::uint32_t>::max)())
+                {
+                    throw(std::length_error("Wordlist exceeds maximum size"));
+                }
+
+                offsets.push_back(static_cast<std::uint32_t>(length));
+
+                // Words before the first weight have the default one.
+                if (!weights.empty() || (weight != 1))
+                {
+                    weights.resize(offsets.size() - 2, 1);
+                    weights.push_back(weight);
+                }
+            }
 
-        // Container with names/surnames that compose the received name.
-        auto names_list{split_name(name)};
+            weight = 1;
+        }};
 
-        // Reduce name list to two names.
-        while (names_list.size() > 2)
+        // Position of the next byte, past the byte order mark if present.
+        std::size_t i{((text.size() >= 3) && (text[0] == 0xEF) &&
+                       (text[1] == 0xBB) && (text[2] == 0xBF))
+                          ? 3u
+                          : 0u};
+
+#if defined(__x86_64__) && (__SIZEOF_WCHAR_T__ == 4)
+        // Bytes before this position are parsed one at a time, since their
+        // block holds characters other than ASCII.
+        std::size_t scalar_end{0};
+#endif
+
+        while (i < text.size())
         {
-            names_list.erase(names_list.begin());
+#if defined(__x86_64__) && (__SIZEOF_WCHAR_T__ == 4)
+            if (i >= scalar_end)
+            {
+                i = parse_ascii_sse2(text, i, characters.data(), length,
+                                     end_word);
+
+                if (i == text.size())
+                {
+                    break;
+                }
+
+                scalar_end = i + 16;
+            }
+#endif
+
+            if ((text[i] == '\n') || (text[i] == '\r'))
+            {
+                end_word();
+                i++;
+            }
+            else if (text[i] == '\t')
+            {
+                weight = parse_weight(text, ++i);
+            }
+            else if (text[i] < 0x80)
+            {
+                characters[length++] = static_cast<wchar_t>(text[i++]);
+            }
+            else
+            {
+                length += utf8::write_wide(characters.data() + length,
+                                           utf8::decode(text, i));
+            }
         }
 
-        // Iterate through each name retrieving random number of letters.
-        for (const auto& name : names_list)
+        // The last line may not end with a line break.
+        end_word();
+
+        if (!weights.empty())
         {
-            nickname.append(name.substr(
-                0, effolkronium::random_thread_local::get<std::size_t>(
-                       2, name.size())));
+            weights.resize(offsets.size() - 1, 1);
         }
 
-        return nickname;
-    };
+        // The list won't grow anymore.
+        characters.resize(length);
+        characters.shrink_to_fit();
+        offsets.shrink_to_fit();
 
-    // Mix first name with last name initial.
-    static std::wstring first_plus_initial(const std::wstring& name)
+        return {std::move(characters), std::move(offsets),
+                weighted_index{weights}};
+    }
+
+    // Parses the weight starting at the received position, moving past it.
+    // Throws unless it is a positive integer ending the line.
+    static std::uint32_t parse_weight(std::span<const unsigned char> text,
+                                      std::size_t& position)
     {
-        // Container with names/surnames that compose the received name.
-        std::vector<std::wstring> names_list{split_name(name)};
+        // Weight being parsed, wider to detect overflows.
+        std::uint64_t weight{0};
+
+        // Position of the first digit.
+        const std::size_t start{position};
+
+        for (; (position < text.size()) && (text[position] >= '0') &&
+               (text[position] <= '9');
+             position++)
+        {
+            weight = (weight * 10) + (text[position] - '0');
+
+            if (weight > (std::numeric_limits<std::uint32_t>::max)())
+            {
+                throw(std::invalid_argument("Word weight is too big"));
+            }
+        }
+
+        if ((position == start) || (weight == 0) ||
+            ((position < text.size()) && (text[position] != '\n') &&
+             (text[position] != '\r')))
+        {
+            throw(std::invalid_argument("Invalid word weight"));
+        }
 
-        return *(names_list.cbegin()) + names_list.crbegin()->front();
+        return static_cast<std::uint32_t>(weight);
     }
 
-    // Mix last name with first name initial.
-    static std::wstring initial_plus_last(const std::wstring& name)
+#if defined(__x86_64__) && (__SIZEOF_WCHAR_T__ == 4)
+    // Parses ASCII text sixteen bytes at a time, ending a word on each line
+    // break. Stops before the first block holding a weight or any other
+    // character, returning the position of the first byte left.
+    template <typename WordEnd>
+    static std::size_t parse_ascii_sse2(std::span<const unsigned char> text,
+                                        std::size_t position, wchar_t* output,
+                                        std::size_t& length,
+                                        const WordEnd& end_word)
     {
-        // Container with names/surnames that compose the received name.
-        auto names_list{split_name(name)};
+        for (; position + 16 <= text.size(); position += 16)
+        {
+            // Sixteen bytes being parsed.
+            const __m128i block{_mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(text.data() + position))};
+
+            if (_mm_movemask_epi8(_mm_or_si128(
+                    block, _mm_cmpeq_epi8(block, _mm_set1_epi8('\t')))) != 0)
+            {
+                break;
+            }
+
+            // Bit set for each byte holding a line break.
+            auto breaks{static_cast<std::uint32_t>(_mm_movemask_epi8(
+                _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('\n')),
+                             _mm_cmpeq_epi8(block, _mm_set1_epi8('\r')))))};
+
+            // Every byte of the block widened to a character.
+            alignas(16) std::array<wchar_t, 16> widened;
+
+            // Halves of the block widened to 16 bits.
+            const __m128i low{_mm_unpacklo_epi8(block, _mm_setzero_si128())};
+            const __m128i high{_mm_unpackhi_epi8(block, _mm_setzero_si128())};
+
+            _mm_store_si128(reinterpret_cast<__m128i*>(widened.data()),
+                            _mm_unpacklo_epi16(low, _mm_setzero_si128()));
+            _mm_store_si128(reinterpret_cast<__m128i*>(widened.data() + 4),
+                            _mm_unpackhi_epi16(low, _mm_setzero_si128()));
+            _mm_store_si128(reinterpret_cast<__m128i*>(widened.data() + 8),
+                            _mm_unpacklo_epi16(high, _mm_setzero_si128()));
+            _mm_store_si128(reinterpret_cast<__m128i*>(widened.data() + 12),
+                            _mm_unpackhi_epi16(high, _mm_setzero_si128()));
+
+            // First character of the block not copied yet.
+            std::size_t start{0};
+
+            // Copies the characters between line breaks, ending a word on each.
+            while (breaks != 0)
+            {
+                // Position of the next line break in the block.
+                const auto line_break{
+                    static_cast<std::size_t>(std::countr_zero(breaks))};
+
+                std::memcpy(output + length, widened.data() + start,
+                            (line_break - start) * sizeof(wchar_t));
+                length += line_break - start;
+                end_word();
+
+                start = line_break + 1;
+                breaks &= breaks - 1;
+            }
+
+            std::memcpy(output + length, widened.data() + start,
+                        (16 - start) * sizeof(wchar_t));
+            length += 16 - start;
+        }
 
-        return names_list.cbegin()->front() + *(names_list.crbegin());
+        return position;
     }
+#endif
 
-    // Reduce a random part of the name.
-    static std::wstring reduce_single_name(const std::wstring& name)
+    // Appends the code points of a native wide string as UTF-32.
+    static void append_utf32(std::u32string& output, std::wstring_view word)
     {
-        // Random part of name.
-        std::wstring single_name{any_name(name)};
-
-        if (single_name.size() > 3)
+        for (std::size_t i{0}; i < word.size();)
         {
-            // Remove all vowel characters from the name unless it's already
-            // small enough.
-            single_name.erase(
-                std::remove_if(single_name.begin() + 1, single_name.end() - 1,
-                               [&single_name](const wchar_t& character) {
-                                   return ((_vowels.find(character) !=
-                                            std::wstring::npos) &&
-                                           (single_name.size() > 3));
-                               }),
-                single_name.end() - 1);
+            output.push_back(utf8::read_wide(word, i));
         }
+    }
+
+    // Appends UTF-32 code points as a native wide string.
+    static void append_native(std::wstring& output, std::u32string_view word)
+    {
+        // Wide characters of a single code point.
+        std::array<wchar_t, 2> units{};
 
-        return single_name;
+        for (const auto& code_point : word)
+        {
+            output.append(units.data(),
+                          utf8::write_wide(units.data(), code_point));
+        }
     }
 
-    // Contains logic to generate a random nickname optionally based on the
-    // player full name.
-    [[nodiscard]] nickname solver(const std::wstring& name) const
+    // Writes the received wordlists into a compiled wordlists file.
+    static void write_compiled(const std::vector<wordlist>& wordlists,
+                               const std::filesystem::path& output_file)
     {
-        // Holds the original word used to generate the nickname.
-        std::wstring original;
+        // Each wordlist offsets and characters, converted to UTF-32.
+        std::vector<std::pair<std::vector<std::uint32_t>, std::u32string>>
+            payloads;
 
-        // Holds the modified version.
-        std::wstring nick;
+        for (const auto& words : wordlists)
+        {
+            // Payload of the current wordlist.
+            auto& [offsets, characters]{payloads.emplace_back()};
 
-        // 1/4 chance of nickname being name related.
-        const std::double_t name_related_probability{0.25};
+            offsets.push_back(0);
 
-        // Proceed to generate nickname based on name.
-        if (!name.empty() && effolkronium::random_thread_local::get<bool>(
-                                 name_related_probability))
-        {
-            // Possible methods utilized to generate a nickname.
-            // Purposefully adds redundancy to first and last name with any name
-            // to add double weight to them.
-            static const generators possible_generators{
-                first_name,         // John
-                last_name,          // Doe
-                any_name,           // Smith
-                initials,           // JSD
-                mix_two,            // DoSmi
-                initial_plus_last,  // JSmith
-                first_plus_initial, // JohnS
-                reduce_single_name  // Jhn
-            };
-
-            original = name;
-
-            // Return a nickname from one of the name based possibilities.
-            nick = (*effolkronium::random_thread_local::get(
-                possible_generators))(name);
+            for (std::size_t i{0}; i < words.size(); i++)
+            {
+                append_utf32(characters, words[i]);
+                offsets.push_back(
+                    static_cast<std::uint32_t>(characters.size()));
+            }
         }
-        // Proceed to generate nickname based on a word list.
-        else if (!_wordlists.empty())
+
+        // Compiled file header.
+        const compiled_header header{_compiled_magic, _compiled_version,
+                                     _compiled_byte_order, payloads.size()};
+
+        // Description of each wordlist, payloads follow the list table.
+        std::vector<compiled_list> list_table;
+
+        // Position in the file where the next payload is going to be written.
+        std::uint64_t position{sizeof(compiled_header) +
+                               (payloads.size() * sizeof(compiled_list))};
+
+        for (std::size_t i{0}; i < payloads.size(); i++)
         {
-            // Randomly select a worldist.
-            word_container drawn_wordlist =
-                *effolkronium::random_thread_local::get(_wordlists);
+            const auto& [offsets, characters]{payloads[i]};
+
+            // Description of the current wordlist.
+            compiled_list& list{list_table.emplace_back()};
 
-            // Randomly selects a word from the wordlist.
-            nick = original =
-                *effolkronium::random_thread_local::get(drawn_wordlist);
+            list.word_count = offsets.size() - 1;
+            list.offsets_position = position;
+            position += offsets.size() * sizeof(std::uint32_t);
+            list.characters_position = position;
+            list.characters_count = characters.size();
+            position += characters.size() * sizeof(char32_t);
+
+            if (!wordlists[i].weights().empty())
+            {
+                list.weights_position = position;
+                position += 2 * list.word_count * sizeof(std::uint32_t);
+            }
         }
-        else
+
+        // File written next to the output and renamed over it once complete,
+        // generators mapping the previous output keep reading its contents.
+        std::filesystem::path temporary_file{output_file};
+
+        temporary_file += ".tmp" + std::to_string(std::random_device{}());
+
+        // Expected output format is header, list table and payloads.
+        std::ofstream output{temporary_file,
+                             std::ios::binary | std::ios::trunc};
+
+        if (!output.is_open())
         {
-            throw(std::invalid_argument(
-                "Received no name and word lists are empty"));
+            throw(std::runtime_error(
+                "Unable to create compiled wordlists file"));
         }
 
-        return format(leetify({nick, original}));
-    };
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        output.write(reinterpret_cast<const char*>(list_table.data()),
+                     static_cast<std::streamsize>(list_table.size() *
+                                                  sizeof(compiled_list)));
+
+        for (std::size_t i{0}; i < payloads.size(); i++)
+        {
+            const auto& [offsets, characters]{payloads[i]};
+
+            // Table drawing each word according to its weight.
+            const weighted_index& weights{wordlists[i].weights()};
+
+            output.write(reinterpret_cast<const char*>(offsets.data()),
+                         static_cast<std::streamsize>(offsets.size() *
+                                                      sizeof(std::uint32_t)));
+            output.write(reinterpret_cast<const char*>(characters.data()),
+                         static_cast<std::streamsize>(characters.size() *
+                                                      sizeof(char32_t)));
+
+            if (!weights.empty())
+            {
+                output.write(
+                    reinterpret_cast<const char*>(weights.table()),
+                    static_cast<std::streamsize>(2 * list_table[i].word_count *
+                                                 sizeof(std::uint32_t)));
+            }
+        }
+
+        output.close();
+
+        // Failure replacing the output, if any.
+        std::error_code failure;
+
+        if (output)
+        {
+            std::filesystem::rename(temporary_file, output_file, failure);
+        }
 
-    // Try parsing the wordlist file and index it into our container.
-    void parse_file(const std::filesystem::path& file)
+        if (!output || failure)
+        {
+            // The incomplete file isn't worth reporting on top of the failure.
+            std::error_code ignored;
+
+            std::filesystem::remove(temporary_file, ignored);
+
+            throw(std::runtime_error(
+                "Unable to write compiled wordlists file"));
+        }
+    }
+
+    // Maps a compiled wordlists file, words are read straight from the mapped
+    // memory whenever wide strings are UTF-32.
+    static std::vector<wordlist> attach_compiled(
+        const std::filesystem::path& file)
     {
-        // Expected wordlist file format is content type string, list of words.
-        std::wifstream tentative_file{file};
+        // Mapped file, kept alive by every wordlist viewing it.
+        const auto mapping{std::make_shared<const mapped_file>(file)};
+
+        // Whether the received amount of 4 bytes values starting at position
+        // fit inside the mapped file.
+        const auto fits = [&mapping](std::uint64_t position,
+                                     std::uint64_t count) {
+            return (position <= mapping->size()) && (position % 4 == 0) &&
+                   (count <= (mapping->size() - position) / 4);
+        };
+
+        // Compiled file header.
+        compiled_header header{};
 
-        // If managed to open the file proceed.
-        if (tentative_file.is_open())
+        if (mapping->size() >= sizeof(header))
         {
-            // Expected delimiter character.
-            const wchar_t delimiter{'\n'};
+            std::memcpy(&header, mapping->data(), sizeof(header));
+        }
+
+        if ((header.magic != _compiled_magic) ||
+            (header.version != _compiled_version) ||
+            (header.byte_order != _compiled_byte_order) ||
+            (header.list_count >
+             (mapping->size() - sizeof(header)) / sizeof(compiled_list)))
+        {
+            throw(std::runtime_error("Invalid compiled wordlists file"));
+        }
+
+        // Wordlists containing at least a single word.
+        std::vector<wordlist> wordlists;
+
+        for (std::uint64_t i{0}; i < header.list_count; i++)
+        {
+            // Description of the current wordlist.
+            compiled_list list{};
+
+            std::memcpy(&list,
+                        mapping->data() + sizeof(header) +
+                            (i * sizeof(compiled_list)),
+                        sizeof(list));
+
+            if ((list.word_count >= mapping->size()) ||
+                !fits(list.offsets_position, list.word_count + 1) ||
+                !fits(list.characters_position, list.characters_count) ||
+                ((list.weights_position != 0) &&
+                 !fits(list.weights_position, 2 * list.word_count)))
+            {
+                throw(std::runtime_error("Invalid compiled wordlists file"));
+            }
+
+            // Position where each word starts, followed by the end of the last.
+            const auto* offsets{reinterpret_cast<const std::uint32_t*>(
+                mapping->data() + list.offsets_position)};
+
+            // Every word laid out back to back.
+            const auto* characters{reinterpret_cast<const char32_t*>(
+                mapping->data() + list.characters_position)};
+
+            if ((offsets[0] != 0) ||
+                (offsets[list.word_count] != list.characters_count))
+            {
+                throw(std::runtime_error("Invalid compiled wordlists file"));
+            }
+
+            // Offsets are checked to be sorted in a single pass reading them
+            // in place, so a corrupted file can't make words read past the
+            // characters.
+            for (std::uint64_t word{0}; word < list.word_count; word++)
+            {
+                if (offsets[word] > offsets[word + 1])
+                {
+                    throw(
+                        std::runtime_error("Invalid compiled wordlists file"));
+                }
+            }
+
+            if (list.word_count == 0)
+            {
+                continue;
+            }
+
+            // Table drawing each word according to its weight.
+            weighted_index weights;
+
+            if (list.weights_position != 0)
+            {
+                // Threshold and alias of each column.
+                const auto* table{reinterpret_cast<const std::uint32_t*>(
+                    mapping->data() + list.weights_position)};
 
-            // Line being read from the file.
-            std::wstring file_line;
+                // Every alias must draw an existing word.
+                for (std::uint64_t column{0}; column < list.word_count;
+                     column++)
+                {
+                    if (table[(2 * column) + 1] >= list.word_count)
+                    {
+                        throw(std::runtime_error(
+                            "Invalid compiled wordlists file"));
+                    }
+                }
 
-            // List of parsed words.
-            word_container words_read{std::vector<std::wstring>()};
+                weights = {table, mapping};
+            }
 
-            // Retrieves list of words.
-            while (std::getline(tentative_file, file_line, delimiter))
+            if constexpr (sizeof(wchar_t) == sizeof(char32_t))
             {
-                words_read.push_back(file_line);
+                wordlists.emplace_back(
+                    reinterpret_cast<const wchar_t*>(characters), offsets,
+                    list.word_count, mapping, std::move(weights));
             }
+            else
+            {
+                // Words converted to native wide strings.
+                std::wstring native_characters;
+
+                // Position where each converted word starts.
+                std::vector<std::uint32_t> native_offsets{0};
+
+                for (std::uint64_t word{0}; word < list.word_count; word++)
+                {
+                    append_native(native_characters,
+                                  {characters + offsets[word],
+                                   offsets[word + 1] - offsets[word]});
+                    native_offsets.push_back(
+                        static_cast<std::uint32_t>(native_characters.size()));
+                }
 
-            // Index our container.
-            _wordlists.push_back(words_read);
+                wordlists.emplace_back(std::move(native_characters),
+                                       std::move(native_offsets),
+                                       std::move(weights));
+            }
         }
+
+        return wordlists;
     }
 };
+
+// Nickname generator drawing from the bundled small state engine.
+using nng = basic_nng<xoshiro256pp>;
+
+inline prepared_name::prepared_name(std::wstring_view name)
+    : prepared_name(name, std::pmr::get_default_resource())
+{
+}
+
+inline prepared_name::prepared_name(std::wstring_view name,
+                                    std::pmr::memory_resource* resource)
+    : _parsed(nng::parse_name(name, resource))
+{
+}
 } // namespace dasmig
\ No newline at end of file
@@ -0,0 +1,27 @@
+#include <exception>
+#include <iostream>
+#include "../dasmig/nicknamegen.hpp"
+
+// Compiles a resources folder into a single file that the nickname generator
+// can load without parsing.
+int main(int argc, char* argv[])
+{
+    if (argc != 3)
+    {
+        std::cerr << "Usage: " << argv[0]
+                  << " <resources folder> <output file.cwords>" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        dasmig::nng::compile(argv[1], argv[2]);
+    }
+    catch (const std::exception& exception)
+    {
+        std::cerr << exception.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
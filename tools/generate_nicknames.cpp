@@ -0,0 +1,446 @@
+#include <charconv>
+#include <condition_variable>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../dasmig/nicknamegen.hpp"
+
+namespace
+{
+// Amount of nicknames generated by a worker before handing them to output.
+constexpr std::size_t chunk_size{16384};
+
+// Options received from the command line.
+struct options
+{
+    // Resources folder or compiled wordlists file.
+    std::filesystem::path resources;
+
+    // Amount of nicknames generated.
+    std::size_t count{1000};
+
+    // File receiving the nicknames, standard output when empty.
+    std::filesystem::path output;
+
+    // Amount of threads generating nicknames.
+    std::size_t threads{std::max(1u, std::thread::hardware_concurrency())};
+
+    // Seed of the first worker generator, random when missing.
+    std::optional<std::uint64_t> seed;
+
+    // UTF-8 file holding a name per line, nicknames are generated from the
+    // names in turn.
+    std::filesystem::path names;
+};
+
+// Compiled wordlists file mapped by every worker generator, so a resources
+// folder is parsed only once. A folder is compiled into a temporary file,
+// removed along with the object.
+class shared_corpus
+{
+  public:
+    // Compiles the resources if they are a folder.
+    explicit shared_corpus(const std::filesystem::path& resources)
+        : _path(resources)
+    {
+        if (std::filesystem::is_directory(resources))
+        {
+            _temporary = std::filesystem::temp_directory_path() /
+                         ("generate_nicknames_" +
+                          std::to_string(std::random_device{}()) + ".cwords");
+
+            dasmig::nng::compile(resources, _temporary);
+            _path = _temporary;
+        }
+    }
+
+    // The temporary file can only be removed once.
+    shared_corpus(const shared_corpus&) = delete;
+    shared_corpus(shared_corpus&&) = delete;
+    shared_corpus& operator=(const shared_corpus&) = delete;
+    shared_corpus& operator=(shared_corpus&&) = delete;
+
+    // Removes the temporary file, if any.
+    ~shared_corpus()
+    {
+        if (!_temporary.empty())
+        {
+            // Failing to remove a temporary file isn't worth reporting.
+            std::error_code ignored;
+
+            std::filesystem::remove(_temporary, ignored);
+        }
+    }
+
+    // Path loaded by every worker generator.
+    [[nodiscard]] const std::filesystem::path& path() const
+    {
+        return _path;
+    }
+
+  private:
+    // Path loaded by every worker generator.
+    std::filesystem::path _path;
+
+    // Temporary compiled file, empty when resources were already compiled.
+    std::filesystem::path _temporary;
+};
+
+// Reads every non blank line of the UTF-8 names file as a prepared name.
+std::vector<dasmig::prepared_name> read_names(
+    const std::filesystem::path& file)
+{
+    std::ifstream input{file, std::ios::binary};
+
+    if (!input)
+    {
+        throw(std::runtime_error("Unable to open names file"));
+    }
+
+    // Names prepared once, reused by every nickname generated from them.
+    std::vector<dasmig::prepared_name> names;
+
+    for (std::string line; std::getline(input, line);)
+    {
+        if (!line.empty() && (line.back() == '\r'))
+        {
+            line.pop_back();
+        }
+
+        // Byte order mark of the first line.
+        if (names.empty() && line.starts_with("\xEF\xBB\xBF"))
+        {
+            line.erase(0, 3);
+        }
+
+        if (!line.empty())
+        {
+            // Name decoded from the line.
+            std::wstring name;
+
+            dasmig::utf8::decode(name, line);
+            names.emplace_back(name);
+        }
+    }
+
+    return names;
+}
+
+// Parses an unsigned decimal option value, throws unless the whole value is
+// one, which rejects negative values instead of wrapping them.
+std::uint64_t parse_number(std::string_view value)
+{
+    // Parsed number.
+    std::uint64_t number{0};
+
+    const auto [end, error]{
+        std::from_chars(value.data(), value.data() + value.size(), number)};
+
+    if ((error != std::errc{}) || (end != value.data() + value.size()) ||
+        value.empty())
+    {
+        throw(std::invalid_argument("Invalid numeric option value"));
+    }
+
+    return number;
+}
+
+// Parses the command line, throws on invalid arguments.
+options parse_options(int argc, char* argv[])
+{
+    // Options read so far.
+    options parsed;
+
+    // Whether the resources argument was received.
+    bool has_resources{false};
+
+    for (int i{1}; i < argc; i++)
+    {
+        const std::string_view argument{argv[i]};
+
+        // Value following an option, throws if missing.
+        const auto value{[&]() -> std::string {
+            if (i + 1 == argc)
+            {
+                throw(std::invalid_argument("Missing value of an option"));
+            }
+            return argv[++i];
+        }};
+
+        if (argument == "-n")
+        {
+            parsed.count = parse_number(value());
+        }
+        else if (argument == "-o")
+        {
+            parsed.output = value();
+        }
+        else if (argument == "-t")
+        {
+            parsed.threads = std::max<std::size_t>(1, parse_number(value()));
+        }
+        else if (argument == "-s")
+        {
+            parsed.seed = parse_number(value());
+        }
+        else if (argument == "-i")
+        {
+            parsed.names = value();
+        }
+        else if (!has_resources && !argument.starts_with('-'))
+        {
+            parsed.resources = argument;
+            has_resources = true;
+        }
+        else
+        {
+            throw(std::invalid_argument("Unknown option"));
+        }
+    }
+
+    if (!has_resources)
+    {
+        throw(std::invalid_argument("Missing resources"));
+    }
+
+    return parsed;
+}
+
+// Generates the nicknames with every worker, writing them in order as each
+// chunk of them is completed.
+void generate(const options& parsed, std::FILE* output)
+{
+    if (!std::filesystem::exists(parsed.resources))
+    {
+        throw(std::invalid_argument("Resources not found"));
+    }
+
+    // Names nicknames are generated from, a single empty name when missing.
+    const std::vector<dasmig::prepared_name> names{
+        parsed.names.empty() ? std::vector<dasmig::prepared_name>(1)
+                             : read_names(parsed.names)};
+
+    if (names.empty())
+    {
+        throw(std::invalid_argument("Names file holds no name"));
+    }
+
+    // Wordlists loaded by every worker, outliving the workers.
+    const shared_corpus corpus{parsed.resources};
+
+    // Amount of chunks of nicknames.
+    const std::size_t chunks{(parsed.count + chunk_size - 1) / chunk_size};
+
+    // Amount of chunks a worker may complete ahead of the output.
+    const std::size_t window{2 * parsed.threads};
+
+    // Guards the completed chunks and the next chunk written.
+    std::mutex guard;
+
+    // Signals a completed chunk or a written one.
+    std::condition_variable changed;
+
+    // UTF-8 text of the chunks completed but not written yet.
+    std::map<std::size_t, std::string> completed;
+
+    // Position of the next chunk written.
+    std::size_t next{0};
+
+    // Failure of any worker, stops every other worker.
+    std::exception_ptr failure;
+
+    // Generates the chunks at the worker position, every threads chunks.
+    const auto work{[&](std::size_t worker) {
+        try
+        {
+            // Each worker owns a generator, so a seed and an amount of
+            // threads always produce the same nicknames.
+            const dasmig::nng generator{
+                corpus.path(),
+                parsed.seed ? std::optional{*parsed.seed + worker}
+                            : std::nullopt};
+
+            // Nickname whose memory is reused by every generated one.
+            dasmig::nickname generated;
+
+            for (std::size_t chunk{worker}; chunk < chunks;
+                 chunk += parsed.threads)
+            {
+                {
+                    std::unique_lock lock{guard};
+
+                    changed.wait(lock, [&] {
+                        return (chunk < next + window) || failure;
+                    });
+
+                    if (failure)
+                    {
+                        return;
+                    }
+                }
+
+                // Position of the first nickname of the chunk.
+                const std::size_t first{chunk * chunk_size};
+
+                // Position after the last nickname of the chunk.
+                const std::size_t last{
+                    std::min(first + chunk_size, parsed.count)};
+
+                // UTF-8 text of the chunk.
+                std::string text;
+
+                text.reserve((last - first) * 24);
+
+                for (std::size_t i{first}; i < last; i++)
+                {
+                    generator.get_nickname(generated, names[i % names.size()]);
+                    dasmig::utf8::encode(text, generated.view());
+                    text.push_back('\n');
+                }
+
+                {
+                    const std::lock_guard lock{guard};
+
+                    completed.emplace(chunk, std::move(text));
+                }
+
+                changed.notify_all();
+            }
+        }
+        catch (...)
+        {
+            {
+                const std::lock_guard lock{guard};
+
+                if (!failure)
+                {
+                    failure = std::current_exception();
+                }
+            }
+
+            changed.notify_all();
+        }
+    }};
+
+    {
+        // Workers generating chunks, joined at the end of the scope.
+        std::vector<std::jthread> workers;
+
+        for (std::size_t i{0}; i < std::min(parsed.threads, chunks); i++)
+        {
+            workers.emplace_back(work, i);
+        }
+
+        while (next < chunks)
+        {
+            // Chunk about to be written.
+            std::string text;
+
+            {
+                std::unique_lock lock{guard};
+
+                changed.wait(lock, [&] {
+                    return completed.contains(next) || failure;
+                });
+
+                if (failure)
+                {
+                    break;
+                }
+
+                text = std::move(completed.extract(next).mapped());
+            }
+
+            if (std::fwrite(text.data(), 1, text.size(), output) !=
+                text.size())
+            {
+                {
+                    const std::lock_guard lock{guard};
+
+                    failure = std::make_exception_ptr(
+                        std::runtime_error("Unable to write nicknames"));
+                }
+
+                changed.notify_all();
+                break;
+            }
+
+            {
+                const std::lock_guard lock{guard};
+
+                next++;
+            }
+
+            changed.notify_all();
+        }
+    }
+
+    if (failure)
+    {
+        std::rethrow_exception(failure);
+    }
+}
+} // namespace
+
+// Generates nicknames at high throughput into a UTF-8 file or the standard
+// output, one nickname per line.
+int main(int argc, char* argv[])
+{
+    // Options received from the command line.
+    options parsed;
+
+    try
+    {
+        parsed = parse_options(argc, argv);
+    }
+    catch (const std::exception& exception)
+    {
+        std::cerr << exception.what() << "\n\nUsage: " << argv[0]
+                  << " [-n count] [-o output file] [-t threads] [-s seed]"
+                     " [-i names file] <resources folder or .cwords file>"
+                  << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        // File receiving the nicknames, closed when leaving the scope.
+        std::unique_ptr<std::FILE, int (*)(std::FILE*)> file{nullptr,
+                                                             &std::fclose};
+
+        if (!parsed.output.empty())
+        {
+            file.reset(std::fopen(parsed.output.string().c_str(), "wb"));
+
+            if (!file)
+            {
+                throw(std::runtime_error("Unable to open output file"));
+            }
+        }
+
+        // Stream receiving the nicknames.
+        std::FILE* output{file ? file.get() : stdout};
+
+        generate(parsed, output);
+
+        if (std::fflush(output) != 0)
+        {
+            throw(std::runtime_error("Unable to write nicknames"));
+        }
+    }
+    catch (const std::exception& exception)
+    {
+        std::cerr << exception.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}